@@ -0,0 +1,100 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+
+#include "fill.hpp"
+
+// z = x + y over rows of a 2D array, once through default_accessor and once
+// through aligned_accessor. With the alignment known, GCC and Clang vectorize
+// the row loop without a peeled prologue and use aligned loads and stores
+// (movaps / vmovaps instead of movups / vmovups); default_accessor needs a
+// runtime alignment check in front of every row.
+
+//================================================================================
+
+using index_type = int;
+
+constexpr size_t byte_alignment = 64;
+
+template <size_t Cols, class Accessor>
+using rows_mdspan = Kokkos::mdspan<typename Accessor::element_type,
+                                   Kokkos::extents<index_type, Kokkos::dynamic_extent, Cols>,
+                                   Kokkos::layout_right, Accessor>;
+
+// The static row length is a multiple of the alignment, so submdspan knows
+// that every row starts aligned and keeps aligned_accessor for it.
+template <class MDSpanX, class MDSpanZ>
+void add_rows(MDSpanX x, MDSpanX y, MDSpanZ z) {
+  for (index_type i = 0; i < z.extent(0); ++i) {
+    auto xr = KokkosEx::submdspan(x, i, Kokkos::full_extent);
+    auto yr = KokkosEx::submdspan(y, i, Kokkos::full_extent);
+    auto zr = KokkosEx::submdspan(z, i, Kokkos::full_extent);
+    for (index_type j = 0; j < zr.extent(0); ++j)
+      zr(j) = xr(j) + yr(j);
+  }
+}
+
+//================================================================================
+
+template <class ConstAccessor, class Accessor, size_t Cols>
+void BM_Add_Rows(benchmark::State& state, ConstAccessor, Accessor,
+                 std::integral_constant<size_t, Cols>, index_type shift) {
+  using value_type = typename Accessor::element_type;
+  const index_type rows = state.range(0);
+  const size_t size = size_t(rows) * Cols + shift;
+  KokkosEx::aligned_vector<value_type, byte_alignment> x_buf(size), y_buf(size), z_buf(size);
+
+  // A shift of one element breaks the alignment for default_accessor.
+  rows_mdspan<Cols, ConstAccessor> x(x_buf.data() + shift, rows);
+  rows_mdspan<Cols, ConstAccessor> y(y_buf.data() + shift, rows);
+  rows_mdspan<Cols, Accessor> z(z_buf.data() + shift, rows);
+  mdspan_benchmark::fill_random(Kokkos::mdspan<value_type, Kokkos::dextents<size_t, 1>>(x_buf.data(), size));
+  mdspan_benchmark::fill_random(Kokkos::mdspan<value_type, Kokkos::dextents<size_t, 1>>(y_buf.data(), size), 4321);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(x.data_handle());
+    benchmark::DoNotOptimize(y.data_handle());
+    benchmark::DoNotOptimize(z.data_handle());
+    add_rows(x, y, z);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(size_t(rows) * Cols * 3 * sizeof(value_type) * state.iterations());
+}
+
+template <class T>
+using default_pair = std::pair<Kokkos::default_accessor<const T>, Kokkos::default_accessor<T>>;
+template <class T>
+using aligned_pair = std::pair<KokkosEx::aligned_accessor<const T, byte_alignment>,
+                               KokkosEx::aligned_accessor<T, byte_alignment>>;
+
+#define MDSPAN_BENCHMARK_ADD_ROWS(name, T, accessors, cols, shift) \
+  BENCHMARK_CAPTURE(BM_Add_Rows, name##_##T##_##cols, accessors<T>::first_type(), \
+                    accessors<T>::second_type(), std::integral_constant<size_t, cols>(), shift) \
+    ->Arg(16)->Arg(1024)
+
+MDSPAN_BENCHMARK_ADD_ROWS(default_accessor, float, default_pair, 64, 0);
+MDSPAN_BENCHMARK_ADD_ROWS(default_accessor_unaligned, float, default_pair, 64, 1);
+MDSPAN_BENCHMARK_ADD_ROWS(aligned_accessor, float, aligned_pair, 64, 0);
+MDSPAN_BENCHMARK_ADD_ROWS(default_accessor, float, default_pair, 1024, 0);
+MDSPAN_BENCHMARK_ADD_ROWS(default_accessor_unaligned, float, default_pair, 1024, 1);
+MDSPAN_BENCHMARK_ADD_ROWS(aligned_accessor, float, aligned_pair, 1024, 0);
+MDSPAN_BENCHMARK_ADD_ROWS(default_accessor, double, default_pair, 64, 0);
+MDSPAN_BENCHMARK_ADD_ROWS(aligned_accessor, double, aligned_pair, 64, 0);
+
+//================================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "fill.hpp"
+
+#include <memory>
+#include <random>
+#include <vector>
+#include <omp.h>
+
+//================================================================================
+
+using index_type = int;
+using grid_extents = Kokkos::dextents<index_type, 3>;
+
+// Random cell coordinates of the deposited particles.
+struct particles {
+  std::vector<index_type> i, j, k;
+  std::vector<double> w;
+
+  particles(size_t n, index_type cells) : i(n), j(n), k(n), w(n) {
+    std::mt19937 gen(17);
+    std::uniform_int_distribution<index_type> cell(0, cells - 1);
+    std::uniform_real_distribution<double> weight(0., 1.);
+    for (size_t p = 0; p < n; ++p) {
+      i[p] = cell(gen);
+      j[p] = cell(gen);
+      k[p] = cell(gen);
+      w[p] = weight(gen);
+    }
+  }
+};
+
+constexpr size_t num_particles = 1 << 22;
+
+//================================================================================
+
+// All threads deposit into one shared grid through atomic_accessor.
+template <class Accessor>
+void BM_Scatter_Add_Atomic_OpenMP(benchmark::State& state, Accessor, index_type cells) {
+  particles parts(num_particles, cells);
+  auto buffer = std::make_unique<double[]>(size_t(cells) * cells * cells);
+  Kokkos::mdspan<double, grid_extents, Kokkos::layout_right, Accessor> grid(buffer.get(), cells, cells, cells);
+
+  for (auto _ : state) {
+    std::fill(buffer.get(), buffer.get() + grid.size(), 0.);
+    #pragma omp parallel for
+    for (size_t p = 0; p < num_particles; ++p) {
+      KokkosEx::atomic_fetch_add_relaxed(grid(parts.i[p], parts.j[p], parts.k[p]), parts.w[p]);
+    }
+    benchmark::DoNotOptimize(buffer.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(num_particles * state.iterations());
+  state.counters["threads"] = omp_get_max_threads();
+}
+BENCHMARK_CAPTURE(BM_Scatter_Add_Atomic_OpenMP, relaxed_cells_16, KokkosEx::atomic_accessor_relaxed<double>(), 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scatter_Add_Atomic_OpenMP, relaxed_cells_64, KokkosEx::atomic_accessor_relaxed<double>(), 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scatter_Add_Atomic_OpenMP, relaxed_cells_256, KokkosEx::atomic_accessor_relaxed<double>(), 256)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scatter_Add_Atomic_OpenMP, seq_cst_cells_64, KokkosEx::atomic_accessor<double>(), 64)->UseRealTime();
+
+//================================================================================
+
+// Every thread deposits into its own copy of the grid, the copies are summed
+// afterwards.
+void BM_Scatter_Add_Privatized_OpenMP(benchmark::State& state, index_type cells) {
+  particles parts(num_particles, cells);
+  const size_t grid_size = size_t(cells) * cells * cells;
+  const int num_threads = omp_get_max_threads();
+  auto buffer = std::make_unique<double[]>(grid_size);
+  auto private_buffers = std::make_unique<double[]>(grid_size * num_threads);
+
+  for (auto _ : state) {
+    #pragma omp parallel
+    {
+      const int t = omp_get_thread_num();
+      double* local_data = private_buffers.get() + t * grid_size;
+      std::fill(local_data, local_data + grid_size, 0.);
+      Kokkos::mdspan<double, grid_extents> local(local_data, cells, cells, cells);
+      #pragma omp for
+      for (size_t p = 0; p < num_particles; ++p) {
+        local(parts.i[p], parts.j[p], parts.k[p]) += parts.w[p];
+      }
+      // Reduce the private grids, each thread owning a range of cells.
+      #pragma omp for
+      for (size_t c = 0; c < grid_size; ++c) {
+        double sum = 0.;
+        for (int s = 0; s < num_threads; ++s)
+          sum += private_buffers[s * grid_size + c];
+        buffer[c] = sum;
+      }
+    }
+    benchmark::DoNotOptimize(buffer.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(num_particles * state.iterations());
+  state.counters["threads"] = num_threads;
+}
+BENCHMARK_CAPTURE(BM_Scatter_Add_Privatized_OpenMP, cells_16, 16)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scatter_Add_Privatized_OpenMP, cells_64, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_Scatter_Add_Privatized_OpenMP, cells_256, 256)->UseRealTime();
+
+//================================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,162 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "fill.hpp"
+
+using index_type = int;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template <class MapSrc, class MapDst>
+size_t buffer_size(MapSrc map_src, MapDst map_dst) {
+  return std::max<size_t>(map_src.required_span_size(), map_dst.required_span_size());
+}
+
+//================================================================================
+
+template <class T, class MapSrc, class MapDst>
+void BM_MDSpan_Copy_2D_naive(benchmark::State& state, T, MapSrc map_src, MapDst map_dst) {
+  auto buff_src = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto buff_dst = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto src = Kokkos::mdspan<T, typename MapSrc::extents_type, typename MapSrc::layout_type>{buff_src.get(), map_src};
+  auto dst = Kokkos::mdspan<T, typename MapDst::extents_type, typename MapDst::layout_type>{buff_dst.get(), map_dst};
+  mdspan_benchmark::fill_random(src);
+  for (auto _ : state) {
+    for(index_type i = 0; i < src.extent(0); ++i) {
+      for (index_type j = 0; j < src.extent(1); ++j) {
+        dst(i, j) = src(i, j);
+      }
+    }
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+template <class T, class MapSrc, class MapDst>
+void BM_MDSpan_Copy_2D_algorithm(benchmark::State& state, T, MapSrc map_src, MapDst map_dst) {
+  auto buff_src = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto buff_dst = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto src = Kokkos::mdspan<T, typename MapSrc::extents_type, typename MapSrc::layout_type>{buff_src.get(), map_src};
+  auto dst = Kokkos::mdspan<T, typename MapDst::extents_type, typename MapDst::layout_type>{buff_dst.get(), map_dst};
+  mdspan_benchmark::fill_random(src);
+  for (auto _ : state) {
+    KokkosEx::copy(src, dst);
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+// Naive copy driven by for_each_index over the destination, which supplies
+// the destination offset incrementally.
+template <class T, class MapSrc, class MapDst>
+void BM_MDSpan_Copy_2D_for_each_index(benchmark::State& state, T, MapSrc map_src, MapDst map_dst) {
+  auto buff_src = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto buff_dst = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto src = Kokkos::mdspan<T, typename MapSrc::extents_type, typename MapSrc::layout_type>{buff_src.get(), map_src};
+  auto dst = Kokkos::mdspan<T, typename MapDst::extents_type, typename MapDst::layout_type>{buff_dst.get(), map_dst};
+  mdspan_benchmark::fill_random(src);
+  for (auto _ : state) {
+    T* dst_ptr = dst.data_handle();
+    KokkosEx::for_each_index(dst.mapping(), [&](index_type offset, index_type i, index_type j) {
+      dst_ptr[offset] = src(i, j);
+    });
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+// Destination written with streaming stores.
+template <class T, class MapSrc, class MapDst>
+void BM_MDSpan_Copy_2D_streaming(benchmark::State& state, T, MapSrc map_src, MapDst map_dst) {
+  auto buff_src = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto buff_dst = std::make_unique<T[]>(buffer_size(map_src, map_dst));
+  auto src = Kokkos::mdspan<T, typename MapSrc::extents_type, typename MapSrc::layout_type>{buff_src.get(), map_src};
+  auto dst = Kokkos::mdspan<T, typename MapDst::extents_type, typename MapDst::layout_type,
+                            KokkosEx::non_temporal_accessor<T>>{buff_dst.get(), map_dst};
+  mdspan_benchmark::fill_random(src);
+  for (auto _ : state) {
+    KokkosEx::copy(src, dst);
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+#define MDSPAN_BENCHMARK_COPY_2D(name, T, map_src, map_dst) \
+  BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_naive, name, T(), map_src, map_dst); \
+  BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_algorithm, name, T(), map_src, map_dst); \
+  BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_for_each_index, name, T(), map_src, map_dst)
+
+using ext_2d = Kokkos::dextents<index_type, 2>;
+using right_map = Kokkos::layout_right::mapping<ext_2d>;
+using left_map = Kokkos::layout_left::mapping<ext_2d>;
+using stride_map = Kokkos::layout_stride::mapping<ext_2d>;
+
+//================================================================================
+// Matching layouts
+
+MDSPAN_BENCHMARK_COPY_2D(right_right_100_100, double, right_map(ext_2d(100, 100)), right_map(ext_2d(100, 100)));
+MDSPAN_BENCHMARK_COPY_2D(right_right_1000_1000, double, right_map(ext_2d(1000, 1000)), right_map(ext_2d(1000, 1000)));
+MDSPAN_BENCHMARK_COPY_2D(left_left_1000_1000, double, left_map(ext_2d(1000, 1000)), left_map(ext_2d(1000, 1000)));
+
+//================================================================================
+// Transposing layouts
+
+MDSPAN_BENCHMARK_COPY_2D(left_right_100_100, double, left_map(ext_2d(100, 100)), right_map(ext_2d(100, 100)));
+MDSPAN_BENCHMARK_COPY_2D(left_right_1000_1000, double, left_map(ext_2d(1000, 1000)), right_map(ext_2d(1000, 1000)));
+MDSPAN_BENCHMARK_COPY_2D(right_left_1000_1000, double, right_map(ext_2d(1000, 1000)), left_map(ext_2d(1000, 1000)));
+// Larger than the last level cache on most machines
+MDSPAN_BENCHMARK_COPY_2D(left_right_3000_3000, double, left_map(ext_2d(3000, 3000)), right_map(ext_2d(3000, 3000)));
+MDSPAN_BENCHMARK_COPY_2D(right_left_3000_3000, double, right_map(ext_2d(3000, 3000)), left_map(ext_2d(3000, 3000)));
+
+//================================================================================
+// layout_stride
+
+// Every other column of a 1000x2000 layout_right array into a dense array
+MDSPAN_BENCHMARK_COPY_2D(stride_right_1000_1000, double,
+  stride_map(ext_2d(1000, 1000), std::array<index_type, 2>{2000, 2}), right_map(ext_2d(1000, 1000)));
+// Same, but column major destination
+MDSPAN_BENCHMARK_COPY_2D(stride_left_1000_1000, double,
+  stride_map(ext_2d(1000, 1000), std::array<index_type, 2>{2000, 2}), left_map(ext_2d(1000, 1000)));
+// Exhaustive strided mappings with equal strides
+MDSPAN_BENCHMARK_COPY_2D(stride_stride_1000_1000, double,
+  stride_map(ext_2d(1000, 1000), std::array<index_type, 2>{1000, 1}),
+  stride_map(ext_2d(1000, 1000), std::array<index_type, 2>{1000, 1}));
+
+//================================================================================
+// Streaming stores
+
+BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_streaming, right_right_1000_1000, double(),
+  right_map(ext_2d(1000, 1000)), right_map(ext_2d(1000, 1000)));
+BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_algorithm, right_right_4000_4000, double(),
+  right_map(ext_2d(4000, 4000)), right_map(ext_2d(4000, 4000)));
+BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_streaming, right_right_4000_4000, double(),
+  right_map(ext_2d(4000, 4000)), right_map(ext_2d(4000, 4000)));
+BENCHMARK_CAPTURE(BM_MDSpan_Copy_2D_streaming, left_right_3000_3000, double(),
+  left_map(ext_2d(3000, 3000)), right_map(ext_2d(3000, 3000)));
+
+BENCHMARK_MAIN();
@@ -0,0 +1,88 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include "fill.hpp"
+
+using index_type = int;
+
+//================================================================================
+
+// Element-wise loop following the destination's memory order.
+template <class T, class LayoutSrc, class LayoutDst>
+void BM_MDSpan_Relayout_2D_naive(benchmark::State& state, T, LayoutSrc, LayoutDst, index_type n) {
+  using ext_t = Kokkos::dextents<index_type, 2>;
+  auto buff_src = std::make_unique<T[]>(size_t(n) * n);
+  auto buff_dst = std::make_unique<T[]>(size_t(n) * n);
+  auto src = Kokkos::mdspan<T, ext_t, LayoutSrc>{buff_src.get(), n, n};
+  auto dst = Kokkos::mdspan<T, ext_t, LayoutDst>{buff_dst.get(), n, n};
+  mdspan_benchmark::fill_random(src);
+  constexpr bool dst_right = std::is_same<LayoutDst, Kokkos::layout_right>::value;
+  for (auto _ : state) {
+    for(index_type a = 0; a < n; ++a) {
+      for (index_type b = 0; b < n; ++b) {
+        if constexpr (dst_right)
+          dst(a, b) = src(a, b);
+        else
+          dst(b, a) = src(b, a);
+      }
+    }
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+template <class T, class LayoutSrc, class LayoutDst>
+void BM_MDSpan_Relayout_2D(benchmark::State& state, T, LayoutSrc, LayoutDst, index_type n) {
+  using ext_t = Kokkos::dextents<index_type, 2>;
+  auto buff_src = std::make_unique<T[]>(size_t(n) * n);
+  auto buff_dst = std::make_unique<T[]>(size_t(n) * n);
+  auto src = Kokkos::mdspan<T, ext_t, LayoutSrc>{buff_src.get(), n, n};
+  auto dst = Kokkos::mdspan<T, ext_t, LayoutDst>{buff_dst.get(), n, n};
+  mdspan_benchmark::fill_random(src);
+  for (auto _ : state) {
+    KokkosEx::relayout(src, dst);
+    benchmark::DoNotOptimize(src.data_handle());
+    benchmark::DoNotOptimize(dst.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(src.size() * sizeof(T) * state.iterations());
+}
+
+#define MDSPAN_BENCHMARK_RELAYOUT_2D(name, T, n) \
+  BENCHMARK_CAPTURE(BM_MDSpan_Relayout_2D_naive, left_right_##name, T(), Kokkos::layout_left(), Kokkos::layout_right(), n); \
+  BENCHMARK_CAPTURE(BM_MDSpan_Relayout_2D, left_right_##name, T(), Kokkos::layout_left(), Kokkos::layout_right(), n); \
+  BENCHMARK_CAPTURE(BM_MDSpan_Relayout_2D_naive, right_left_##name, T(), Kokkos::layout_right(), Kokkos::layout_left(), n); \
+  BENCHMARK_CAPTURE(BM_MDSpan_Relayout_2D, right_left_##name, T(), Kokkos::layout_right(), Kokkos::layout_left(), n)
+
+// From L1 resident to larger than the last level cache on most machines
+MDSPAN_BENCHMARK_RELAYOUT_2D(float_64, float, 64);
+MDSPAN_BENCHMARK_RELAYOUT_2D(float_256, float, 256);
+MDSPAN_BENCHMARK_RELAYOUT_2D(float_1024, float, 1024);
+MDSPAN_BENCHMARK_RELAYOUT_2D(float_4096, float, 4096);
+MDSPAN_BENCHMARK_RELAYOUT_2D(double_64, double, 64);
+MDSPAN_BENCHMARK_RELAYOUT_2D(double_256, double, 256);
+MDSPAN_BENCHMARK_RELAYOUT_2D(double_1000, double, 1000);
+MDSPAN_BENCHMARK_RELAYOUT_2D(double_4096, double, 4096);
+
+//================================================================================
+
+BENCHMARK_MAIN();
@@ -0,0 +1,97 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+using index_type = int;
+using ext_3d = Kokkos::dextents<index_type, 3>;
+
+using byte_mask = Kokkos::mdspan<bool, ext_3d>;
+using packed_mask = Kokkos::mdspan<bool, ext_3d, Kokkos::layout_right, KokkosEx::packed_bool_accessor<bool>>;
+
+template <class MDSpan>
+void fill_mask(MDSpan m, unsigned seed) {
+  std::mt19937 gen(seed);
+  for (index_type i = 0; i < m.extent(0); ++i)
+    for (index_type j = 0; j < m.extent(1); ++j)
+      for (index_type k = 0; k < m.extent(2); ++k)
+        m(i, j, k) = (gen() & 1) != 0;
+}
+
+// Owns the storage of a mask of either representation.
+template <class MDSpan>
+struct mask_buffer;
+
+template <>
+struct mask_buffer<byte_mask> {
+  std::unique_ptr<bool[]> data;
+  byte_mask mask;
+  explicit mask_buffer(ext_3d exts)
+    : data(std::make_unique<bool[]>(Kokkos::layout_right::mapping<ext_3d>(exts).required_span_size())),
+      mask(data.get(), exts) {}
+  size_t bytes() const { return mask.size() * sizeof(bool); }
+};
+
+template <>
+struct mask_buffer<packed_mask> {
+  std::unique_ptr<uint64_t[]> data;
+  packed_mask mask;
+  explicit mask_buffer(ext_3d exts)
+    : data(std::make_unique<uint64_t[]>(KokkosEx::packed_bool_words(Kokkos::layout_right::mapping<ext_3d>(exts).required_span_size()))),
+      mask(KokkosEx::packed_bit_pointer<uint64_t>(data.get()), exts) {}
+  size_t bytes() const { return KokkosEx::packed_bool_words(mask.size()) * sizeof(uint64_t); }
+};
+
+//================================================================================
+
+template <class MDSpan, class... DynSizes>
+void BM_Mask_Count_3D(benchmark::State& state, MDSpan, DynSizes... dyn) {
+  mask_buffer<MDSpan> m(ext_3d(dyn...));
+  fill_mask(m.mask, 1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(m.mask.data_handle());
+    benchmark::DoNotOptimize(KokkosEx::mask_count(m.mask));
+  }
+  state.SetBytesProcessed(m.bytes() * state.iterations());
+  state.SetItemsProcessed(m.mask.size() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_Mask_Count_3D, bytes_400_400_400, byte_mask(), 400, 400, 400);
+BENCHMARK_CAPTURE(BM_Mask_Count_3D, packed_400_400_400, packed_mask(), 400, 400, 400);
+
+template <class MDSpan, class... DynSizes>
+void BM_Mask_And_3D(benchmark::State& state, MDSpan, DynSizes... dyn) {
+  mask_buffer<MDSpan> a(ext_3d(dyn...)), b(ext_3d(dyn...)), d(ext_3d(dyn...));
+  fill_mask(a.mask, 1);
+  fill_mask(b.mask, 2);
+  for (auto _ : state) {
+    KokkosEx::mask_and(a.mask, b.mask, d.mask);
+    benchmark::DoNotOptimize(d.mask.data_handle());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(3 * d.bytes() * state.iterations());
+  state.SetItemsProcessed(d.mask.size() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_Mask_And_3D, bytes_400_400_400, byte_mask(), 400, 400, 400);
+BENCHMARK_CAPTURE(BM_Mask_And_3D, packed_400_400_400, packed_mask(), 400, 400, 400);
+
+BENCHMARK_MAIN();
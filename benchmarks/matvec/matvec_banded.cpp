@@ -0,0 +1,113 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+//================================================================================
+
+using index_type = int;
+using value_type = double;
+using ext_1d = Kokkos::dextents<index_type, 1>;
+using ext_2d = Kokkos::dextents<index_type, 2>;
+
+template <class Layout>
+struct banded_problem {
+  using matrix_type = Kokkos::mdspan<value_type, ext_2d, Layout>;
+  index_type n;
+  std::unique_ptr<value_type[]> buffer_A, x, y;
+  matrix_type A;
+
+  template <size_t KL, size_t KU>
+  banded_problem(index_type n_, KokkosEx::layout_banded<KL, KU>)
+    : n(n_),
+      buffer_A(std::make_unique<value_type[]>(typename Layout::template mapping<ext_2d>(ext_2d(n, n)).required_span_size())),
+      x(std::make_unique<value_type[]>(n)),
+      y(std::make_unique<value_type[]>(n)),
+      A(buffer_A.get(), ext_2d(n, n))
+  {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<value_type> val_dist(-1, 1);
+    const size_t span = A.mapping().required_span_size();
+    for (size_t k = 0; k < span; ++k)
+      buffer_A[k] = 0;
+    for (index_type i = 0; i < n; ++i) {
+      x[i] = val_dist(gen);
+      const index_type first = i > index_type(KL) ? i - index_type(KL) : 0;
+      for (index_type j = first; j < n && j <= i + index_type(KU); ++j)
+        A(i, j) = val_dist(gen);
+    }
+  }
+
+  size_t band_bytes(size_t KL, size_t KU) const { return n * (KL + KU + 1) * sizeof(value_type); }
+};
+
+//================================================================================
+
+// Row by row over the band, through the mdspan.
+template <class Layout, size_t KL, size_t KU>
+void BM_MDSpan_MatVec_Banded_Rows(benchmark::State& state, Layout, KokkosEx::layout_banded<KL, KU> band, index_type n) {
+  banded_problem<Layout> p(n, band);
+  auto A = p.A;
+  for (auto _ : state) {
+    for (index_type i = 0; i < n; ++i) {
+      const index_type first = i > index_type(KL) ? i - index_type(KL) : 0;
+      const index_type last = i + index_type(KU) + 1 < n ? i + index_type(KU) + 1 : n;
+      value_type sum = 0;
+      for (index_type j = first; j < last; ++j)
+        sum += A(i, j) * p.x[j];
+      p.y[i] = sum;
+    }
+    benchmark::DoNotOptimize(p.y.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(p.band_bytes(KL, KU) * state.iterations());
+}
+
+// The band storage kernel.
+template <size_t KL, size_t KU>
+void BM_MDSpan_MatVec_Banded_Kernel(benchmark::State& state, KokkosEx::layout_banded<KL, KU> band, index_type n) {
+  banded_problem<KokkosEx::layout_banded<KL, KU>> p(n, band);
+  Kokkos::mdspan<const value_type, ext_1d> x(p.x.get(), n);
+  Kokkos::mdspan<value_type, ext_1d> y(p.y.get(), n);
+  for (auto _ : state) {
+    KokkosEx::banded_matrix_vector_product(p.A, x, y);
+    benchmark::DoNotOptimize(p.y.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(p.band_bytes(KL, KU) * state.iterations());
+}
+
+using tridiagonal = KokkosEx::layout_banded<1, 1>;
+using pentadiagonal = KokkosEx::layout_banded<2, 2>;
+
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Rows, right_tridiagonal_4000, Kokkos::layout_right(), tridiagonal(), 4000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Rows, banded_tridiagonal_4000, tridiagonal(), tridiagonal(), 4000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Kernel, tridiagonal_4000, tridiagonal(), 4000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Rows, right_pentadiagonal_4000, Kokkos::layout_right(), pentadiagonal(), 4000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Rows, banded_pentadiagonal_4000, pentadiagonal(), pentadiagonal(), 4000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Kernel, pentadiagonal_4000, pentadiagonal(), 4000);
+// Too large for dense storage
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Rows, banded_pentadiagonal_4000000, pentadiagonal(), pentadiagonal(), 4000000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Banded_Kernel, pentadiagonal_4000000, pentadiagonal(), 4000000);
+
+BENCHMARK_MAIN();
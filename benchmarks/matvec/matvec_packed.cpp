@@ -0,0 +1,111 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+//================================================================================
+
+using index_type = int;
+using value_type = double;
+using ext_2d = Kokkos::dextents<index_type, 2>;
+using packed_layout = KokkosEx::layout_blas_packed<KokkosEx::upper_triangle_t, KokkosEx::row_major_t>;
+
+template <class Layout>
+struct symmetric_problem {
+  using matrix_type = Kokkos::mdspan<value_type, ext_2d, Layout>;
+  index_type n;
+  std::unique_ptr<value_type[]> buffer_A, x, y;
+  matrix_type A;
+
+  explicit symmetric_problem(index_type n_)
+    : n(n_),
+      buffer_A(std::make_unique<value_type[]>(typename Layout::template mapping<ext_2d>(ext_2d(n, n)).required_span_size())),
+      x(std::make_unique<value_type[]>(n)),
+      y(std::make_unique<value_type[]>(n)),
+      A(buffer_A.get(), ext_2d(n, n))
+  {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<value_type> val_dist(-1, 1);
+    for (index_type i = 0; i < n; ++i) {
+      x[i] = val_dist(gen);
+      for (index_type j = i; j < n; ++j)
+        A(i, j) = A(j, i) = val_dist(gen);
+    }
+  }
+
+  size_t matrix_bytes() const { return A.mapping().required_span_size() * sizeof(value_type); }
+};
+
+//================================================================================
+
+// y = A x row by row, whatever the layout.
+template <class Layout>
+void BM_MDSpan_MatVec_Symmetric(benchmark::State& state, Layout, index_type n) {
+  symmetric_problem<Layout> p(n);
+  auto A = p.A;
+  for (auto _ : state) {
+    for (index_type i = 0; i < n; ++i) {
+      value_type sum = 0;
+      for (index_type j = 0; j < n; ++j)
+        sum += A(i, j) * p.x[j];
+      p.y[i] = sum;
+    }
+    benchmark::DoNotOptimize(p.y.get());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(p.matrix_bytes() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric, right_2000, Kokkos::layout_right(), 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric, packed_2000, packed_layout(), 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric, right_6000, Kokkos::layout_right(), 6000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric, packed_6000, packed_layout(), 6000);
+
+// y = A x reading every stored element once: row i of the packed upper
+// triangle contributes to y(i) as a row and to y(j), j > i, as a column.
+void BM_MDSpan_MatVec_Symmetric_Packed_OnePass(benchmark::State& state, index_type n) {
+  symmetric_problem<packed_layout> p(n);
+  auto A = p.A;
+  value_type *x = p.x.get();
+  value_type *y = p.y.get();
+  for (auto _ : state) {
+    for (index_type i = 0; i < n; ++i)
+      y[i] = 0;
+    for (index_type i = 0; i < n; ++i) {
+      // The row is contiguous from the diagonal on.
+      const value_type *row = &A(i, i) - i;
+      const value_type xi = x[i];
+      value_type sum = row[i] * xi;
+      for (index_type j = i + 1; j < n; ++j) {
+        sum += row[j] * x[j];
+        y[j] += row[j] * xi;
+      }
+      y[i] += sum;
+    }
+    benchmark::DoNotOptimize(y);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(p.matrix_bytes() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric_Packed_OnePass, size_2000, 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_MatVec_Symmetric_Packed_OnePass, size_6000, 6000);
+
+BENCHMARK_MAIN();
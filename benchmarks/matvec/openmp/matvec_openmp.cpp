@@ -119,6 +119,78 @@ BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec, left, lmdspan<double,Kokkos::dynamic_
 BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec, right, rmdspan<double,Kokkos::dynamic_extent,Kokkos::dynamic_extent>(), 100000, 5000);
 
 
+//================================================================================
+
+template <class MDSpanMatrix, class MDSpanVector>
+void OpenMP_matvec_add(MDSpanMatrix A, MDSpanVector x, MDSpanVector y) {
+  using value_type = typename MDSpanVector::value_type;
+  #pragma omp parallel for
+  for(index_type i = 0; i < A.extent(0); i ++) {
+    value_type y_i = 0;
+    for(index_type j = 0; j < A.extent(1); j ++) {
+      y_i += A(i,j) * x(j);
+    }
+    y(i) += y_i;
+  }
+}
+
+// y += (alpha * A) x, with alpha * A either materialized into a temporary
+// before every product or read lazily through KokkosEx::scaled.
+template <class MDSpanMatrix, class... DynSizes>
+void BM_MDSpan_OpenMP_MatVec_Scaled(benchmark::State& state, MDSpanMatrix, bool lazy, DynSizes... dyn) {
+
+  using value_type = typename MDSpanMatrix::value_type;
+  using MDSpanVector = lmdspan<value_type,Kokkos::dynamic_extent>;
+
+  auto buffer_size_A = MDSpanMatrix{nullptr, dyn...}.mapping().required_span_size();
+  auto buffer_A = std::make_unique<value_type[]>(buffer_size_A);
+  auto A = MDSpanMatrix{buffer_A.get(), dyn...};
+  OpenMP_first_touch_2D(A);
+  mdspan_benchmark::fill_random(A);
+
+  auto buffer_alpha_A = std::make_unique<value_type[]>(buffer_size_A);
+  auto alpha_A = MDSpanMatrix{buffer_alpha_A.get(), dyn...};
+  OpenMP_first_touch_2D(alpha_A);
+
+  auto buffer_x = std::make_unique<value_type[]>(A.extent(1));
+  auto x = MDSpanVector{buffer_x.get(), A.extent(1)};
+  OpenMP_first_touch_1D(x);
+  mdspan_benchmark::fill_random(x);
+
+  auto buffer_y = std::make_unique<value_type[]>(A.extent(0));
+  auto y = MDSpanVector{buffer_y.get(), A.extent(0)};
+  OpenMP_first_touch_1D(y);
+
+  const value_type alpha = 0.5;
+  int R = 10;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(A.data_handle());
+    benchmark::DoNotOptimize(y.data_handle());
+    for(int r=0; r<R; r++) {
+      if(lazy) {
+        OpenMP_matvec_add(KokkosEx::scaled(alpha, A), x, y);
+      } else {
+        #pragma omp parallel for
+        for(index_type i = 0; i < A.extent(0); i ++) {
+          for(index_type j = 0; j < A.extent(1); j ++) {
+            alpha_A(i,j) = alpha * A(i,j);
+          }
+        }
+        OpenMP_matvec_add(alpha_A, x, y);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  size_t num_elements = 2 * A.extent(0) * A.extent(1) + 2 * A.extent(0);
+  state.SetBytesProcessed( R * num_elements * sizeof(value_type) * state.iterations() * global_repeat);
+  state.counters["repeats"] = global_repeat;
+}
+
+BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec_Scaled, right_materialized, rmdspan<double,Kokkos::dynamic_extent,Kokkos::dynamic_extent>(), false, 20000, 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec_Scaled, right_lazy, rmdspan<double,Kokkos::dynamic_extent,Kokkos::dynamic_extent>(), true, 20000, 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec_Scaled, left_materialized, lmdspan<double,Kokkos::dynamic_extent,Kokkos::dynamic_extent>(), false, 20000, 2000);
+BENCHMARK_CAPTURE(BM_MDSpan_OpenMP_MatVec_Scaled, left_lazy, lmdspan<double,Kokkos::dynamic_extent,Kokkos::dynamic_extent>(), true, 20000, 2000);
+
 template <class MDSpanMatrix, class... DynSizes>
 void BM_MDSpan_OpenMP_MatVec_Raw_Left(benchmark::State& state, MDSpanMatrix, DynSizes... dyn) {
 
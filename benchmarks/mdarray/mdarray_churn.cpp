@@ -0,0 +1,86 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+using index_type = int;
+using ext_t = Kokkos::dextents<index_type, 2>;
+
+//================================================================================
+
+// One time step's temporaries: count n x n mdarrays of doubles, created,
+// written once and destroyed in creation order, which is not the reverse
+// order an arena takes back cheaply. make(n) creates one mdarray; after_step
+// runs once all of them are gone.
+template <class Make, class AfterStep>
+void churn(benchmark::State& state, index_type count, index_type n, Make make, AfterStep after_step) {
+  using mdarray_type = decltype(make(n));
+  std::vector<mdarray_type> temporaries;
+  temporaries.reserve(count);
+  for (auto _ : state) {
+    for (index_type t = 0; t < count; ++t) {
+      temporaries.push_back(make(n));
+      auto& a = temporaries.back();
+      a(t % n, n - 1) = t;
+      benchmark::DoNotOptimize(a.data());
+    }
+    temporaries.clear();
+    after_step();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(int64_t(count) * state.iterations());
+}
+
+void BM_MDArray_Churn_vector(benchmark::State& state, index_type count, index_type n) {
+  churn(state, count, n,
+    [](index_type m) { return KokkosEx::mdarray<double, ext_t>(ext_t(m, m)); },
+    [] {});
+}
+
+void BM_MDArray_Churn_pool(benchmark::State& state, index_type count, index_type n) {
+  KokkosEx::pool_resource pool;
+  churn(state, count, n,
+    [&](index_type m) { return KokkosEx::pool_mdarray<double, ext_t>(ext_t(m, m), &pool); },
+    [] {});
+}
+
+void BM_MDArray_Churn_arena(benchmark::State& state, index_type count, index_type n) {
+  KokkosEx::arena_resource arena;
+  churn(state, count, n,
+    [&](index_type m) { return KokkosEx::arena_mdarray<double, ext_t>(ext_t(m, m), &arena); },
+    [&] { arena.reset(); });
+}
+
+#define MDSPAN_BENCHMARK_CHURN(name, count, n) \
+  BENCHMARK_CAPTURE(BM_MDArray_Churn_vector, name, count, n); \
+  BENCHMARK_CAPTURE(BM_MDArray_Churn_pool, name, count, n); \
+  BENCHMARK_CAPTURE(BM_MDArray_Churn_arena, name, count, n)
+
+// From a few cache lines to above the size where malloc switches to mmap
+MDSPAN_BENCHMARK_CHURN(count_16_size_4_4, 16, 4);
+MDSPAN_BENCHMARK_CHURN(count_16_size_32_32, 16, 32);
+MDSPAN_BENCHMARK_CHURN(count_16_size_128_128, 16, 128);
+MDSPAN_BENCHMARK_CHURN(count_8_size_256_256, 8, 256);
+
+//================================================================================
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 #include "fill.hpp"
 
 #include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -119,6 +120,42 @@ MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_OpenMP_Stencil_3D, left_, lmdspan, 400, 400, 4
 
 //================================================================================
 
+// Same stencil through the stencil engine, with the middle dimension split
+// across the threads.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_OpenMP_Stencil_3D_Engine(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  auto buffer_size = MDSpan{nullptr, dyn...}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), dyn...};
+  OpenMP_first_touch_3D(s);
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = MDSpan{buffer_o.get(), dyn...};
+  OpenMP_first_touch_3D(o);
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  KokkosEx::stencil(KokkosEx::execution::openmp, s, o, global_delta);
+
+  for (auto _ : state) {
+    KokkosEx::stencil(KokkosEx::execution::openmp, s, o, global_delta);
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_OpenMP_Stencil_3D_Engine, right_, rmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_OpenMP_Stencil_3D_Engine, left_, lmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_OpenMP_Stencil_3D_Engine, right_, rmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_OpenMP_Stencil_3D_Engine, left_, lmdspan, 400, 400, 400);
+
+//================================================================================
+
 template <class T, class SizeX, class SizeY, class SizeZ>
 void BM_Raw_OpenMP_Stencil_3D_right(benchmark::State& state, T, SizeX x, SizeY y, SizeZ z) {
 
@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+//================================================================================
+
+using index_type = int;
+using value_type = float;
+using extents_type = Kokkos::dextents<index_type, 2>;
+
+template <class Layout>
+struct grid_2d {
+  using mdspan_type = Kokkos::mdspan<value_type, extents_type, Layout>;
+  typename Layout::template mapping<extents_type> map;
+  std::unique_ptr<value_type[]> buffer;
+  mdspan_type s;
+
+  grid_2d(index_type n0, index_type n1)
+    : map(extents_type(n0, n1)),
+      buffer(std::make_unique<value_type[]>(map.required_span_size())),
+      s(buffer.get(), map)
+  {
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<value_type> val_dist(0, 1);
+    for(index_type i = 0; i < n0; i ++)
+      for(index_type j = 0; j < n1; j ++)
+        s(i, j) = val_dist(gen);
+  }
+};
+
+// Five point stencil, iterating in row major order.
+template <class Layout>
+void BM_MDSpan_Stencil_2D(benchmark::State& state, Layout, index_type n0, index_type n1) {
+  grid_2d<Layout> in(n0, n1), out(n0, n1);
+  auto s = in.s;
+  auto o = out.s;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o.data_handle());
+    for(index_type i = 1; i < n0 - 1; i ++) {
+      for(index_type j = 1; j < n1 - 1; j ++) {
+        o(i, j) = s(i, j) + s(i - 1, j) + s(i + 1, j) + s(i, j - 1) + s(i, j + 1);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(size_t(n0 - 2) * size_t(n1 - 2) * 5 * sizeof(value_type) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, right_1024_1024, Kokkos::layout_right(), 1024, 1024);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, morton_1024_1024, KokkosEx::layout_morton(), 1024, 1024);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, hilbert_1024_1024, KokkosEx::layout_hilbert(), 1024, 1024);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, right_4096_4096, Kokkos::layout_right(), 4096, 4096);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, morton_4096_4096, KokkosEx::layout_morton(), 4096, 4096);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D, hilbert_4096_4096, KokkosEx::layout_hilbert(), 4096, 4096);
+
+// Same stencil, visiting the output in storage order along the Hilbert curve.
+void BM_MDSpan_Stencil_2D_Hilbert_Walk(benchmark::State& state, index_type n0, index_type n1) {
+  grid_2d<KokkosEx::layout_hilbert> in(n0, n1), out(n0, n1);
+  auto s = in.s;
+  auto o = out.s;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o.data_handle());
+    KokkosEx::hilbert_for_each(o.mapping(), [&](index_type offset, index_type i, index_type j) {
+      if (i == 0 || j == 0 || i == n0 - 1 || j == n1 - 1)
+        return;
+      o.data_handle()[offset] = s(i, j) + s(i - 1, j) + s(i + 1, j) + s(i, j - 1) + s(i, j + 1);
+    });
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(size_t(n0 - 2) * size_t(n1 - 2) * 5 * sizeof(value_type) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D_Hilbert_Walk, size_1024_1024, 1024, 1024);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_2D_Hilbert_Walk, size_4096_4096, 4096, 4096);
+
+BENCHMARK_MAIN();
@@ -16,6 +16,7 @@
 #include "fill.hpp"
 
 #include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
 
 #include <benchmark/benchmark.h>
 
@@ -36,6 +37,12 @@ template <class T, size_t... Es>
 using lmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_left>;
 template <class T, size_t... Es>
 using rmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_right>;
+template <class T, size_t... Es>
+using lmdspan_restrict = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_left,
+                                        Kokkos::Experimental::restrict_accessor<T>>;
+template <class T, size_t... Es>
+using rmdspan_restrict = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_right,
+                                        Kokkos::Experimental::restrict_accessor<T>>;
 
 //================================================================================
 
@@ -81,6 +88,320 @@ MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, right_, rmdspan, 80, 80, 80);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, left_, lmdspan, 80, 80, 80);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, right_, rmdspan, 400, 400, 400);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, left_, lmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, right_restrict_, rmdspan_restrict, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, left_restrict_, lmdspan_restrict, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, right_restrict_, rmdspan_restrict, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D, left_restrict_, lmdspan_restrict, 400, 400, 400);
+
+//================================================================================
+
+// Same stencil over an arbitrary layout, with a plain fill since not every
+// layout supports submdspan.
+template <class Layout, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Layout(benchmark::State& state, Layout, DynSizes... dyn) {
+
+  using value_type = int;
+  using extents_type = Kokkos::dextents<index_type, 3>;
+  using mdspan_type = Kokkos::mdspan<value_type, extents_type, Layout>;
+  typename Layout::template mapping<extents_type> map(extents_type(dyn...));
+  auto buffer_size = map.required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = mdspan_type{buffer_s.get(), map};
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = mdspan_type{buffer_o.get(), map};
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<> val_dist(0, 127);
+  for(index_type i = 0; i < s.extent(0); i ++)
+    for(index_type j = 0; j < s.extent(1); j ++)
+      for(index_type k = 0; k < s.extent(2); k ++)
+        s(i, j, k) = o(i, j, k) = val_dist(gen);
+
+  int d = global_delta;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    for(index_type i = d; i < s.extent(0)-d; i ++) {
+      for(index_type j = d; j < s.extent(1)-d; j ++) {
+        for(index_type k = d; k < s.extent(2)-d; k ++) {
+          value_type sum_local = 0;
+          for(index_type di = i-d; di < i+d+1; di++) {
+          for(index_type dj = j-d; dj < j+d+1; dj++) {
+          for(index_type dk = k-d; dk < k+d+1; dk++) {
+            sum_local += s(di, dj, dk);
+          }}}
+          o(i,j,k) = sum_local;
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Layout, right_128_128_128, Kokkos::layout_right(), 128, 128, 128);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Layout, morton_128_128_128, KokkosEx::layout_morton(), 128, 128, 128);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Layout, right_256_256_256, Kokkos::layout_right(), 256, 256, 256);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Layout, morton_256_256_256, KokkosEx::layout_morton(), 256, 256, 256);
+
+//================================================================================
+
+// Same stencil, but the output is written with streaming stores so that it
+// doesn't evict the input from the caches.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Streaming(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  using out_mdspan = Kokkos::mdspan<value_type, typename MDSpan::extents_type, typename MDSpan::layout_type,
+                                    Kokkos::Experimental::non_temporal_accessor<value_type>>;
+  auto buffer_size = MDSpan{nullptr, dyn...}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = out_mdspan{buffer_o.get(), dyn...};
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  using index_type = typename MDSpan::index_type;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    for(index_type i = d; i < s.extent(0)-d; i ++) {
+      for(index_type j = d; j < s.extent(1)-d; j ++) {
+        for(index_type k = d; k < s.extent(2)-d; k ++) {
+          value_type sum_local = 0;
+          for(index_type di = i-d; di < i+d+1; di++) {
+          for(index_type dj = j-d; dj < j+d+1; dj++) {
+          for(index_type dk = k-d; dk < k+d+1; dk++) {
+            sum_local += s(di, dj, dk);
+          }}}
+          o(i,j,k) = sum_local;
+        }
+      }
+    }
+    Kokkos::Experimental::non_temporal_fence();
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Streaming, right_, rmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Streaming, right_, rmdspan, 400, 400, 400);
+
+//================================================================================
+
+// Same stencil, with the interior walked by for_each_index: the offset of the
+// center is carried along the loops and the neighbors are reached by adding
+// strides to it.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_ForEachIndex(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  auto buffer_size = MDSpan{nullptr, dyn...}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = MDSpan{buffer_o.get(), dyn...};
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  using index_type = typename MDSpan::index_type;
+  auto interior = KokkosEx::submdspan(o, std::pair<index_type, index_type>(d, o.extent(0)-d),
+                                         std::pair<index_type, index_type>(d, o.extent(1)-d),
+                                         std::pair<index_type, index_type>(d, o.extent(2)-d));
+  const value_type* s_ptr = s.data_handle() + (interior.data_handle() - o.data_handle());
+  const index_type s0 = s.stride(0), s1 = s.stride(1), s2 = s.stride(2);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    value_type* o_ptr = interior.data_handle();
+    KokkosEx::for_each_index(interior.mapping(), [&](index_type offset, index_type, index_type, index_type) {
+      value_type sum_local = 0;
+      for(index_type di = -global_delta; di < global_delta+1; di++) {
+      for(index_type dj = -global_delta; dj < global_delta+1; dj++) {
+      for(index_type dk = -global_delta; dk < global_delta+1; dk++) {
+        sum_local += s_ptr[offset + di*s0 + dj*s1 + dk*s2];
+      }}}
+      o_ptr[offset] = sum_local;
+    });
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_ForEachIndex, right_, rmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_ForEachIndex, left_, lmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_ForEachIndex, right_, rmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_ForEachIndex, left_, lmdspan, 400, 400, 400);
+
+//================================================================================
+
+// Same stencil through the stencil engine, which sweeps the grid in memory
+// order, in cache sized tiles if its planes don't fit in cache.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Engine(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  auto buffer_size = MDSpan{nullptr, dyn...}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = MDSpan{buffer_o.get(), dyn...};
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    KokkosEx::stencil(s, o, global_delta);
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Engine, right_, rmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Engine, left_, lmdspan, 80, 80, 80);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Engine, right_, rmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Engine, left_, lmdspan, 400, 400, 400);
+
+//================================================================================
+
+static constexpr size_t global_steps = 8;
+
+// global_steps time steps of the stencil, ping-ponging between two grids:
+// one sweep per step with the naive loops, fused sweeps with stencil_iterate.
+template <class MDSpan>
+void Naive_Stencil_3D_Step(MDSpan s, MDSpan o) {
+  using value_type = typename MDSpan::value_type;
+  using index_type = typename MDSpan::index_type;
+  int d = global_delta;
+  for(index_type i = d; i < s.extent(0)-d; i ++) {
+    for(index_type j = d; j < s.extent(1)-d; j ++) {
+      for(index_type k = d; k < s.extent(2)-d; k ++) {
+        value_type sum_local = 0;
+        for(index_type di = i-d; di < i+d+1; di++) {
+        for(index_type dj = j-d; dj < j+d+1; dj++) {
+        for(index_type dk = k-d; dk < k+d+1; dk++) {
+          sum_local += s(di, dj, dk);
+        }}}
+        o(i,j,k) = sum_local;
+      }
+    }
+  }
+}
+
+template <bool Engine, class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Iterate_impl(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  auto buffer_size = MDSpan{nullptr, dyn...}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<value_type[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = MDSpan{buffer_o.get(), dyn...};
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    if constexpr (Engine) {
+      KokkosEx::stencil_iterate(s, o, global_delta, global_steps);
+    } else {
+      for(size_t t = 0; t < global_steps; ++t) {
+        if(t % 2 == 0) Naive_Stencil_3D_Step(s, o);
+        else Naive_Stencil_3D_Step(o, s);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(value_type) * global_steps * state.iterations());
+}
+
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Iterate(benchmark::State& state, MDSpan s, DynSizes... dyn) {
+  BM_MDSpan_Stencil_3D_Iterate_impl<false>(state, s, dyn...);
+}
+
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Iterate_Engine(benchmark::State& state, MDSpan s, DynSizes... dyn) {
+  BM_MDSpan_Stencil_3D_Iterate_impl<true>(state, s, dyn...);
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Iterate, right_, rmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Iterate, left_, lmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Iterate_Engine, right_, rmdspan, 400, 400, 400);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Stencil_3D_Iterate_Engine, left_, lmdspan, 400, 400, 400);
+
+//================================================================================
+
+// Stencil reading its input from compact storage in Format, with float
+// arithmetic and output.
+template <class Format, class... DynSizes>
+void BM_MDSpan_Stencil_3D_Quantized(benchmark::State& state, Format, DynSizes... dyn) {
+
+  using value_type = float;
+  using storage_type = typename Format::storage_type;
+  using extents_type = Kokkos::dextents<index_type, 3>;
+  using accessor_type = KokkosEx::quantized_accessor<value_type, Format>;
+  extents_type exts(dyn...);
+  Kokkos::layout_right::mapping<extents_type> map(exts);
+  auto buffer_size = map.required_span_size();
+
+  auto buffer_s = std::make_unique<storage_type[]>(buffer_size);
+  Kokkos::mdspan<value_type, extents_type, Kokkos::layout_right, accessor_type> s_init(buffer_s.get(), map, accessor_type());
+  mdspan_benchmark::fill_random(s_init);
+  Kokkos::mdspan<const value_type, extents_type, Kokkos::layout_right,
+                 KokkosEx::quantized_accessor<const value_type, Format>> s = s_init;
+
+  auto buffer_o = std::make_unique<value_type[]>(buffer_size);
+  auto o = Kokkos::mdspan<value_type, extents_type>{buffer_o.get(), exts};
+  mdspan_benchmark::fill_random(o);
+
+  int d = global_delta;
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    for(index_type i = d; i < s.extent(0)-d; i ++) {
+      for(index_type j = d; j < s.extent(1)-d; j ++) {
+        for(index_type k = d; k < s.extent(2)-d; k ++) {
+          value_type sum_local = 0;
+          for(index_type di = i-d; di < i+d+1; di++) {
+          for(index_type dj = j-d; dj < j+d+1; dj++) {
+          for(index_type dk = k-d; dk < k+d+1; dk++) {
+            sum_local += s(di, dj, dk);
+          }}}
+          o(i,j,k) = sum_local;
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  size_t num_inner_elements = (s.extent(0)-d) * (s.extent(1)-d) * (s.extent(2)-d);
+  size_t stencil_num = (2*d+1) * (2*d+1) * (2*d+1);
+  state.SetBytesProcessed( num_inner_elements * stencil_num * sizeof(storage_type) * state.iterations());
+  state.SetItemsProcessed( num_inner_elements * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Quantized, fp16_400_400_400, KokkosEx::float16_format(), 400, 400, 400);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Quantized, bf16_400_400_400, KokkosEx::bfloat16_format(), 400, 400, 400);
+BENCHMARK_CAPTURE(BM_MDSpan_Stencil_3D_Quantized, int8_400_400_400, KokkosEx::integer_format<int8_t>(), 400, 400, 400);
 
 //================================================================================
 
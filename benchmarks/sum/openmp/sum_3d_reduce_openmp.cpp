@@ -0,0 +1,158 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+
+#include "sum_3d_common.hpp"
+#include "fill.hpp"
+
+#include <functional>
+#include <memory>
+#include <omp.h>
+
+//================================================================================
+
+using index_type = int;
+
+template <class T, size_t... Es>
+using lmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_left>;
+template <class T, size_t... Es>
+using rmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_right>;
+
+// Runs at 1, 2, 4, ..., omp_get_max_threads() threads
+#define MDSPAN_BENCHMARK_3D_THREADS(bench_template, prefix, md_template, X, Y, Z) \
+BENCHMARK_CAPTURE( \
+  bench_template, prefix##fixed_##X##_##Y##_##Z, md_template<int, X, Y, Z>{nullptr} \
+)->RangeMultiplier(2)->Range(1, omp_get_max_threads())->UseRealTime(); \
+BENCHMARK_CAPTURE( \
+  bench_template, prefix##dyn_d##X##_d##Y##_d##Z, md_template<int, Kokkos::dynamic_extent, Kokkos::dynamic_extent, Kokkos::dynamic_extent>{}, X, Y, Z \
+)->RangeMultiplier(2)->Range(1, omp_get_max_threads())->UseRealTime()
+
+//================================================================================
+
+// Same hand-written loop as BM_MDSpan_Sum_3D_OpenMP, with a fixed team size
+// and one reduction per iteration.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Sum_3D_loop_OpenMP(benchmark::State& state, MDSpan, DynSizes... dyn) {
+  using value_type = typename MDSpan::value_type;
+  auto buffer = std::make_unique<value_type[]>(
+    MDSpan{nullptr, dyn...}.mapping().required_span_size()
+  );
+  auto s = MDSpan{buffer.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+  const int num_threads = state.range(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = 0;
+    #pragma omp parallel for num_threads(num_threads) reduction(+:sum) default(none) shared(s)
+    for (index_type i = 0; i < s.extent(0); ++i) {
+      for (index_type j = 0; j < s.extent(1); ++j) {
+        for (index_type k = 0; k < s.extent(2); ++k) {
+          sum += s(i, j, k);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(value_type) * state.iterations());
+  state.counters["threads"] = num_threads;
+}
+MDSPAN_BENCHMARK_3D_THREADS(BM_MDSpan_Sum_3D_loop_OpenMP, right_, rmdspan, 200, 200, 200);
+MDSPAN_BENCHMARK_3D_THREADS(BM_MDSpan_Sum_3D_loop_OpenMP, left_, lmdspan, 200, 200, 200);
+
+//================================================================================
+
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Sum_3D_reduce_OpenMP(benchmark::State& state, MDSpan, DynSizes... dyn) {
+  using value_type = typename MDSpan::value_type;
+  auto buffer = std::make_unique<value_type[]>(
+    MDSpan{nullptr, dyn...}.mapping().required_span_size()
+  );
+  auto s = MDSpan{buffer.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+  const int num_threads = state.range(0);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = KokkosEx::reduce(KokkosEx::execution::openmp_policy{num_threads}, s, value_type(0), std::plus<>());
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(value_type) * state.iterations());
+  state.counters["threads"] = num_threads;
+}
+MDSPAN_BENCHMARK_3D_THREADS(BM_MDSpan_Sum_3D_reduce_OpenMP, right_, rmdspan, 200, 200, 200);
+MDSPAN_BENCHMARK_3D_THREADS(BM_MDSpan_Sum_3D_reduce_OpenMP, left_, lmdspan, 200, 200, 200);
+
+//================================================================================
+
+#if MDSPAN_USE_STD_EXECUTION
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Sum_3D_reduce_std_par(benchmark::State& state, MDSpan, DynSizes... dyn) {
+  using value_type = typename MDSpan::value_type;
+  auto buffer = std::make_unique<value_type[]>(
+    MDSpan{nullptr, dyn...}.mapping().required_span_size()
+  );
+  auto s = MDSpan{buffer.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = KokkosEx::reduce(std::execution::par, s, value_type(0), std::plus<>());
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D_REAL_TIME(BM_MDSpan_Sum_3D_reduce_std_par, right_, rmdspan, 200, 200, 200);
+MDSPAN_BENCHMARK_ALL_3D_REAL_TIME(BM_MDSpan_Sum_3D_reduce_std_par, left_, lmdspan, 200, 200, 200);
+#endif
+
+//================================================================================
+
+template <class T, class SizeX, class SizeY, class SizeZ>
+void BM_Raw_Sum_3D_right_OpenMP(benchmark::State& state, T, SizeX x, SizeY y, SizeZ z) {
+  auto buffer = std::make_unique<T[]>(x * y * z);
+  {
+    // just for setup...
+    auto wrapped = Kokkos::mdspan<T, Kokkos::dextents<index_type, 1>>{buffer.get(), x*y*z};
+    mdspan_benchmark::fill_random(wrapped);
+  }
+  const int num_threads = state.range(0);
+  T* data = buffer.get();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(data);
+    T sum = 0;
+    #pragma omp parallel for num_threads(num_threads) reduction(+:sum) default(none) shared(data,x,y,z)
+    for (index_type i = 0; i < x; ++i) {
+      for (index_type j = 0; j < y; ++j) {
+        for (index_type k = 0; k < z; ++k) {
+          sum += data[k + j*z + i*z*y];
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(x * y * z * sizeof(T) * state.iterations());
+  state.counters["threads"] = num_threads;
+}
+BENCHMARK_CAPTURE(
+  BM_Raw_Sum_3D_right_OpenMP, size_200_200_200, int(), 200, 200, 200
+)->RangeMultiplier(2)->Range(1, omp_get_max_threads())->UseRealTime();
+
+//================================================================================
+
+BENCHMARK_MAIN();
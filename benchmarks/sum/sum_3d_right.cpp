@@ -14,7 +14,9 @@
 //
 //@HEADER
 #include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
 
+#include <array>
 #include <memory>
 #include <random>
 
@@ -64,6 +66,171 @@ MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_right, left_, lmdspan, 20, 20, 20);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_right, right_, rmdspan, 200, 200, 200);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_right, left_, lmdspan, 200, 200, 200);
 
+// Same sum through for_each, which walks the span in memory order and merges
+// the contiguous dimensions into a single loop.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Sum_3D_ForEach(benchmark::State& state, MDSpan, DynSizes... dyn) {
+
+  using value_type = typename MDSpan::value_type;
+  auto buffer = std::make_unique<value_type[]>(
+    MDSpan{nullptr, dyn...}.mapping().required_span_size()
+  );
+
+  auto s = MDSpan{buffer.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = 0;
+    KokkosEx::for_each(s, [&](value_type x) { sum += x; });
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(value_type) * state.iterations());
+}
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_ForEach, right_, rmdspan, 20, 20, 20);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_ForEach, left_, lmdspan, 20, 20, 20);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_ForEach, right_, rmdspan, 200, 200, 200);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_3D_ForEach, left_, lmdspan, 200, 200, 200);
+
+//================================================================================
+
+// Sum over float data stored in a compact Format, decoded on the fly. Bytes
+// processed count the stored bytes, items processed the elements.
+template <class Format, class... DynSizes>
+void BM_MDSpan_Sum_3D_right_Quantized(benchmark::State& state, Format, DynSizes... dyn) {
+  using storage_type = typename Format::storage_type;
+  using extents_type = Kokkos::dextents<index_type, 3>;
+  using accessor_type = KokkosEx::quantized_accessor<float, Format>;
+  extents_type exts(dyn...);
+  Kokkos::layout_right::mapping<extents_type> map(exts);
+
+  auto values = std::make_unique<float[]>(map.required_span_size());
+  Kokkos::mdspan<float, extents_type> v(values.get(), exts);
+  mdspan_benchmark::fill_random(v);
+  auto buffer = std::make_unique<storage_type[]>(map.required_span_size());
+  Kokkos::mdspan<float, extents_type, Kokkos::layout_right, accessor_type> q(buffer.get(), map, accessor_type());
+  KokkosEx::copy(v, q);
+
+  Kokkos::mdspan<const float, extents_type, Kokkos::layout_right,
+                 KokkosEx::quantized_accessor<const float, Format>> s = q;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    float sum = 0;
+    for(index_type i = 0; i < s.extent(0); ++i) {
+      for (index_type j = 0; j < s.extent(1); ++j) {
+        for (index_type k = 0; k < s.extent(2); ++k) {
+          sum += s(i, j, k);
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(storage_type) * state.iterations());
+  state.SetItemsProcessed(s.size() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_right, float_items_size_200_200_200,
+  Kokkos::mdspan<float, Kokkos::dextents<index_type, 3>>(), 200, 200, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_right_Quantized, fp16_size_200_200_200, KokkosEx::float16_format(), 200, 200, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_right_Quantized, bf16_size_200_200_200, KokkosEx::bfloat16_format(), 200, 200, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_right_Quantized, int8_size_200_200_200, KokkosEx::integer_format<int8_t>(), 200, 200, 200);
+
+//================================================================================
+
+// Sum over a layout_stride view of 200^3 ints whose dimensions are nested in
+// the order perm, largest stride first, e.g. {1, 2, 0} for a layout_left
+// array transposed in its first two dimensions. Either last index fastest, or
+// through for_each_index, which puts the smallest stride innermost.
+void BM_MDSpan_Sum_3D_Permuted(benchmark::State& state, std::array<int, 3> perm, bool memory_order) {
+  using ext_t = Kokkos::dextents<index_type, 3>;
+  const std::array<index_type, 3> exts{200, 200, 200};
+  std::array<index_type, 3> strides{};
+  strides[perm[2]] = 1;
+  strides[perm[1]] = exts[perm[2]];
+  strides[perm[0]] = exts[perm[2]] * exts[perm[1]];
+  Kokkos::layout_stride::mapping<ext_t> map(ext_t(exts), strides);
+
+  auto buffer = std::make_unique<int[]>(map.required_span_size());
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> s(buffer.get(), map);
+  mdspan_benchmark::fill_random(s);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    int sum = 0;
+    if (memory_order) {
+      const int* p = s.data_handle();
+      KokkosEx::for_each_index(s.mapping(), [&](index_type offset, index_type, index_type, index_type) {
+        sum += p[offset];
+      });
+    } else {
+      for(index_type i = 0; i < s.extent(0); ++i) {
+        for (index_type j = 0; j < s.extent(1); ++j) {
+          for (index_type k = 0; k < s.extent(2); ++k) {
+            sum += s(i, j, k);
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(int) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_Permuted, order_1_2_0_right, std::array<int, 3>{1, 2, 0}, false);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_Permuted, order_1_2_0_for_each_index, std::array<int, 3>{1, 2, 0}, true);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_Permuted, order_2_0_1_right, std::array<int, 3>{2, 0, 1}, false);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_Permuted, order_2_0_1_for_each_index, std::array<int, 3>{2, 0, 1}, true);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_Permuted, order_0_1_2_for_each_index, std::array<int, 3>{0, 1, 2}, true);
+
+// Quantized sum over a layout_left array: last index fastest, or through
+// for_each, which hands the accessor the elements in memory order.
+template <class Format>
+void BM_MDSpan_Sum_3D_left_Quantized(benchmark::State& state, Format, bool memory_order, index_type n) {
+  using storage_type = typename Format::storage_type;
+  using extents_type = Kokkos::dextents<index_type, 3>;
+  using accessor_type = KokkosEx::quantized_accessor<float, Format>;
+  extents_type exts(n, n, n);
+  Kokkos::layout_left::mapping<extents_type> map(exts);
+
+  auto values = std::make_unique<float[]>(map.required_span_size());
+  Kokkos::mdspan<float, extents_type, Kokkos::layout_left> v(values.get(), exts);
+  mdspan_benchmark::fill_random(v);
+  auto buffer = std::make_unique<storage_type[]>(map.required_span_size());
+  Kokkos::mdspan<float, extents_type, Kokkos::layout_left, accessor_type> q(buffer.get(), map, accessor_type());
+  KokkosEx::copy(v, q);
+
+  Kokkos::mdspan<const float, extents_type, Kokkos::layout_left,
+                 KokkosEx::quantized_accessor<const float, Format>> s = q;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    float sum = 0;
+    if (memory_order) {
+      KokkosEx::for_each(s, [&](float x) { sum += x; });
+    } else {
+      for(index_type i = 0; i < s.extent(0); ++i) {
+        for (index_type j = 0; j < s.extent(1); ++j) {
+          for (index_type k = 0; k < s.extent(2); ++k) {
+            sum += s(i, j, k);
+          }
+        }
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(storage_type) * state.iterations());
+  state.SetItemsProcessed(s.size() * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_left_Quantized, fp16_right_size_200_200_200, KokkosEx::float16_format(), false, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_left_Quantized, fp16_for_each_size_200_200_200, KokkosEx::float16_format(), true, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_left_Quantized, int8_right_size_200_200_200, KokkosEx::integer_format<int8_t>(), false, 200);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_3D_left_Quantized, int8_for_each_size_200_200_200, KokkosEx::integer_format<int8_t>(), true, 200);
+
 //================================================================================
 
 BENCHMARK_CAPTURE(
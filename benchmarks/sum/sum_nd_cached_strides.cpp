@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+
+#include <array>
+#include <memory>
+#include <random>
+#include <utility>
+
+#include "../fill.hpp"
+
+//================================================================================
+
+// Sums over rank 3 to 6 dynamic extents, comparing layout_right, which
+// recomputes the strides from the extents, with layout_cached<layout_right>,
+// which stores them in the mapping.
+
+using index_type = int;
+
+template <size_t R, class MDSpan, class T, class... Indices>
+inline void sum_nested(const MDSpan& s, T& sum, Indices... idx) {
+  if constexpr (R == MDSpan::rank()) {
+    sum += s(idx...);
+  } else {
+    for (index_type i = 0; i < s.extent(R); ++i) {
+      sum_nested<R + 1>(s, sum, idx..., i);
+    }
+  }
+}
+
+template <class Layout, size_t Rank>
+void BM_MDSpan_Sum_ND(benchmark::State& state, Layout, std::integral_constant<size_t, Rank>, index_type n) {
+  using value_type = int;
+  using extents_type = Kokkos::dextents<index_type, Rank>;
+  std::array<index_type, Rank> exts;
+  exts.fill(n);
+  using MDSpan = Kokkos::mdspan<value_type, extents_type, Layout>;
+  const typename MDSpan::mapping_type map{extents_type(exts)};
+
+  auto buffer = std::make_unique<value_type[]>(map.required_span_size());
+  auto s = MDSpan{buffer.get(), map};
+  mdspan_benchmark::fill_random(s);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = 0;
+    sum_nested<0>(s, sum);
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(value_type) * state.iterations());
+  state.counters["mapping_bytes"] = sizeof(map);
+}
+
+// Random accesses, where the offset computation cannot be hoisted out of
+// the loops.
+template <class MDSpan, class T, size_t... R>
+inline void sum_at(const MDSpan& s, T& sum, const index_type* idx, std::index_sequence<R...>) {
+  sum += s(idx[R]...);
+}
+
+template <class Layout, size_t Rank>
+void BM_MDSpan_Gather_ND(benchmark::State& state, Layout, std::integral_constant<size_t, Rank>, index_type n) {
+  using value_type = int;
+  using extents_type = Kokkos::dextents<index_type, Rank>;
+  std::array<index_type, Rank> exts;
+  exts.fill(n);
+  using MDSpan = Kokkos::mdspan<value_type, extents_type, Layout>;
+  const typename MDSpan::mapping_type map{extents_type(exts)};
+
+  auto buffer = std::make_unique<value_type[]>(map.required_span_size());
+  auto s = MDSpan{buffer.get(), map};
+  mdspan_benchmark::fill_random(s);
+
+  constexpr size_t num_accesses = 1 << 16;
+  auto indices = std::make_unique<index_type[]>(num_accesses * Rank);
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<index_type> dist(0, n - 1);
+  for (size_t i = 0; i < num_accesses * Rank; ++i)
+    indices[i] = dist(gen);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    value_type sum = 0;
+    for (size_t a = 0; a < num_accesses; ++a)
+      sum_at(s, sum, indices.get() + a * Rank, std::make_index_sequence<Rank>());
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(num_accesses * state.iterations());
+}
+
+#define MDSPAN_BENCHMARK_SUM_ND(rank, n) \
+BENCHMARK_CAPTURE( \
+  BM_MDSpan_Sum_ND, right_rank##rank##_##n, Kokkos::layout_right(), std::integral_constant<size_t, rank>(), n \
+); \
+BENCHMARK_CAPTURE( \
+  BM_MDSpan_Sum_ND, cached_right_rank##rank##_##n, KokkosEx::layout_cached<Kokkos::layout_right>(), \
+  std::integral_constant<size_t, rank>(), n \
+); \
+BENCHMARK_CAPTURE( \
+  BM_MDSpan_Gather_ND, right_rank##rank##_##n, Kokkos::layout_right(), std::integral_constant<size_t, rank>(), n \
+); \
+BENCHMARK_CAPTURE( \
+  BM_MDSpan_Gather_ND, cached_right_rank##rank##_##n, KokkosEx::layout_cached<Kokkos::layout_right>(), \
+  std::integral_constant<size_t, rank>(), n \
+)
+
+MDSPAN_BENCHMARK_SUM_ND(3, 128);
+MDSPAN_BENCHMARK_SUM_ND(4, 38);
+MDSPAN_BENCHMARK_SUM_ND(5, 18);
+MDSPAN_BENCHMARK_SUM_ND(6, 11);
+MDSPAN_BENCHMARK_SUM_ND(6, 4);
+
+//================================================================================
+
+BENCHMARK_MAIN();
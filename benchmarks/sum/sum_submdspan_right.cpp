@@ -15,6 +15,7 @@
 //@HEADER
 #include <mdspan/mdspan.hpp>
 
+#include <array>
 #include <memory>
 #include <random>
 #include <iostream>
@@ -69,6 +70,105 @@ MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_Sum_Subspan_3D_right, left_, lmdspan, 200, 200
 
 //================================================================================
 
+template <class MDSpan>
+typename MDSpan::value_type sum_3d(MDSpan s) {
+  typename MDSpan::value_type sum = 0;
+  using index_type = typename MDSpan::index_type;
+  for(index_type i = 0; i < s.extent(0); ++i) {
+    for (index_type j = 0; j < s.extent(1); ++j) {
+      for (index_type k = 0; k < s.extent(2); ++k) {
+        sum += s(i, j, k);
+      }
+    }
+  }
+  return sum;
+}
+
+// Sums every step-th element along the last dimension of s, a layout_stride
+// submdspan, with k innermost. Optionally through a prefetching_accessor that
+// looks ahead along the stride of k.
+template <class MDSpan, class... DynSizes>
+void BM_MDSpan_Sum_Strided_3D_right(benchmark::State& state, MDSpan, bool prefetch, index_type step, DynSizes... dyn) {
+  using value_type = typename MDSpan::value_type;
+  auto buffer = std::make_unique<value_type[]>(
+    MDSpan{nullptr, dyn...}.mapping().required_span_size()
+  );
+  auto s = MDSpan{buffer.get(), dyn...};
+  mdspan_benchmark::fill_random(s);
+  auto sub = KokkosEx::submdspan(s, Kokkos::full_extent, Kokkos::full_extent,
+                                 KokkosEx::strided_slice<index_type, index_type, index_type>{0, s.extent(2), step});
+  auto sub_prefetch = KokkosEx::with_prefetch(sub);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sub.data_handle());
+    value_type sum = prefetch ? sum_3d(sub_prefetch) : sum_3d(sub);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetBytesProcessed(sub.size() * sizeof(value_type) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_4_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, false, 4);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_4_prefetch_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, true, 4);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_16_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, false, 16);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_16_prefetch_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, true, 16);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_64_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, false, 64);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, right_step_64_prefetch_100_100_3200, rmdspan<int, 100, 100, 3200>{nullptr}, true, 64);
+// k innermost on layout_left: every access is a new cache line
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, left_step_1_200_200_200, lmdspan<int, 200, 200, 200>{nullptr}, false, 1);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Strided_3D_right, left_step_1_prefetch_200_200_200, lmdspan<int, 200, 200, 200>{nullptr}, true, 1);
+
+//================================================================================
+
+template <class MDSpan>
+typename MDSpan::value_type sum_2d(MDSpan s) {
+  typename MDSpan::value_type sum = 0;
+  using index_type = typename MDSpan::index_type;
+  for (index_type j = 0; j < s.extent(0); ++j) {
+    for (index_type k = 0; k < s.extent(1); ++k) {
+      sum += s(j, k);
+    }
+  }
+  return sum;
+}
+
+// Sums the planes submdspan(s, i, full_extent, full_extent) of a layout_stride
+// array whose planes are padded to plane_stride elements, either as they are
+// or through coalesce_dimensions, which merges the two dimensions of a plane
+// into one loop.
+void BM_MDSpan_Sum_Subspan_3D_Stride(benchmark::State& state, bool coalesce, index_type n0, index_type n1, index_type n2, index_type plane_stride) {
+  using ext_t = Kokkos::dextents<index_type, 3>;
+  Kokkos::layout_stride::mapping<ext_t> map(ext_t(n0, n1, n2), std::array<index_type, 3>{plane_stride, n2, 1});
+  auto buffer = std::make_unique<int[]>(map.required_span_size());
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> s(buffer.get(), map);
+  mdspan_benchmark::fill_random(s);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    int sum = 0;
+    for (index_type i = 0; i < s.extent(0); ++i) {
+      auto plane = KokkosEx::submdspan(s, i, Kokkos::full_extent, Kokkos::full_extent);
+      if (coalesce) {
+        sum += sum_2d(Kokkos::mdspan<int, Kokkos::dextents<index_type, 2>, Kokkos::layout_stride>(
+          plane.data_handle(), KokkosEx::coalesce_dimensions(plane.mapping())));
+      } else {
+        sum += sum_2d(plane);
+      }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(s.size() * sizeof(int) * state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, size_20_20_20, false, 20, 20, 20, 400);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, coalesced_size_20_20_20, true, 20, 20, 20, 400);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, size_200_200_200, false, 200, 200, 200, 40000);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, coalesced_size_200_200_200, true, 200, 200, 200, 40000);
+// Short rows, where the inner loop of a plane is dominated by its overhead.
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, size_20_2000_4, false, 20, 2000, 4, 8064);
+BENCHMARK_CAPTURE(BM_MDSpan_Sum_Subspan_3D_Stride, coalesced_size_20_2000_4, true, 20, 2000, 4, 8064);
+
+//================================================================================
+
 BENCHMARK_CAPTURE(
   BM_Raw_Sum_3D_right, size_20_20_20, int(), size_t(20), size_t(20), size_t(20)
 );
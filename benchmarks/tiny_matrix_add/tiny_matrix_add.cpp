@@ -28,6 +28,12 @@ template <class T, size_t... Es>
 using lmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_left>;
 template <class T, size_t... Es>
 using rmdspan = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_right>;
+template <class T, size_t... Es>
+using lmdspan_restrict = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_left,
+                                        Kokkos::Experimental::restrict_accessor<T>>;
+template <class T, size_t... Es>
+using rmdspan_restrict = Kokkos::mdspan<T, Kokkos::extents<index_type, Es...>, Kokkos::layout_right,
+                                        Kokkos::Experimental::restrict_accessor<T>>;
 
 //================================================================================
 
@@ -62,8 +68,59 @@ void BM_MDSpan_TinyMatrixSum_right(benchmark::State& state, MDSpan, DynSizes...
   size_t num_elements = (s.extent(0) * s.extent(1) * s.extent(2));
   state.SetBytesProcessed( num_elements * 3 * sizeof(value_type) * state.iterations() );
 }
-MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_TinyMatrixSum_right, right_, lmdspan, 1000000, 3, 3);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_TinyMatrixSum_right, right_, rmdspan, 1000000, 3, 3);
 MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_TinyMatrixSum_right, left_, lmdspan, 1000000, 3, 3);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_TinyMatrixSum_right, right_restrict_, rmdspan_restrict, 1000000, 3, 3);
+MDSPAN_BENCHMARK_ALL_3D(BM_MDSpan_TinyMatrixSum_right, left_restrict_, lmdspan_restrict, 1000000, 3, 3);
+
+//================================================================================
+
+// Only the leading extent is dynamic, so the strides of layout_right are
+// compile time constants and the offsets must be the ones the raw version
+// below computes by hand.
+template <class T>
+void BM_MDSpan_TinyMatrixSum_right_static_strides(benchmark::State& state, T, index_type x) {
+
+  using MDSpan = rmdspan<T, Kokkos::dynamic_extent, 3, 3>;
+  auto buffer_size = MDSpan{nullptr, x}.mapping().required_span_size();
+
+  auto buffer_s = std::make_unique<T[]>(buffer_size);
+  auto s = MDSpan{buffer_s.get(), x};
+  mdspan_benchmark::fill_random(s);
+
+  auto buffer_o = std::make_unique<T[]>(buffer_size);
+  auto o = MDSpan{buffer_o.get(), x};
+  mdspan_benchmark::fill_random(o);
+
+  for(index_type i = 0; i < x; i ++) {
+    for(index_type j = 0; j < 3; j ++) {
+      for(index_type k = 0; k < 3; k ++) {
+        if(s.mapping()(i,j,k) != k + j*3 + i*3*3) {
+          state.SkipWithError("layout_right offsets differ from the raw version");
+          return;
+        }
+      }
+    }
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(o);
+    benchmark::DoNotOptimize(o.data_handle());
+    benchmark::DoNotOptimize(s);
+    benchmark::DoNotOptimize(s.data_handle());
+    for(index_type i = 0; i < s.extent(0); i ++) {
+      for(index_type j = 0; j < s.extent(1); j ++) {
+        for(index_type k = 0; k < s.extent(2); k ++) {
+          o(i,j,k) += s(i,j,k);
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  size_t num_elements = (s.extent(0) * s.extent(1) * s.extent(2));
+  state.SetBytesProcessed( num_elements * 3 * sizeof(T) * state.iterations() );
+}
+BENCHMARK_CAPTURE(BM_MDSpan_TinyMatrixSum_right_static_strides, size_d1000000_3_3, int(), 1000000);
 
 //================================================================================
 
@@ -15,11 +15,6 @@
 //@HEADER
 #include <mdspan/mdspan.hpp>
 
-// Just checking __cpp_lib_int_pow2 isn't enough for some GCC versions.
-// The <bit> header exists, but std::has_single_bit does not.
-#if defined(__cpp_lib_int_pow2) && __cplusplus >= 202002L
-#  include <bit>
-#endif
 #include <cassert>
 #include <chrono>
 #include <cstdlib> // aligned_alloc, posix_memalign (if applicable)
@@ -68,103 +63,6 @@ using index_type = int;
   constexpr char assume_aligned_method[] = "(none)";
 #endif
 
-// Some compilers other than Clang or GCC like to define __clang__ or __GNUC__.
-// Thus, we order the tests from most to least specific.
-#if defined(__ICL)
-#  define _MDSPAN_ALIGN_VALUE_ATTRIBUTE( BYTE_ALIGNMENT ) __declspec(align_value( BYTE_ALIGNMENT ));
-  constexpr char align_attribute_method[] = "__declspec(align_value(BYTE_ALIGNMENT))";
-#elif defined(__ICC)
-#  define _MDSPAN_ALIGN_VALUE_ATTRIBUTE( BYTE_ALIGNMENT ) __attribute__((align_value( BYTE_ALIGNMENT )));
-  constexpr char align_attribute_method[] = "__attribute__((align_value(BYTE_ALIGNMENT)))";
-#elif defined(__clang__)
-#  define _MDSPAN_ALIGN_VALUE_ATTRIBUTE( BYTE_ALIGNMENT ) __attribute__((align_value( BYTE_ALIGNMENT )));
-  constexpr char align_attribute_method[] = "__attribute__((align_value(BYTE_ALIGNMENT)))";
-#else
-#  define _MDSPAN_ALIGN_VALUE_ATTRIBUTE( BYTE_ALIGNMENT )
-  constexpr char align_attribute_method[] = "(none)";
-#endif
-
-constexpr bool
-is_nonzero_power_of_two(const std::size_t x)
-{
-// Just checking __cpp_lib_int_pow2 isn't enough for some GCC versions.
-// The <bit> header exists, but std::has_single_bit does not.
-#if defined(__cpp_lib_int_pow2) && __cplusplus >= 202002L
-  return std::has_single_bit(x);
-#else
-  return x != 0 && (x & (x - 1)) == 0;
-#endif
-}
-
-template<class ElementType>
-constexpr bool
-valid_byte_alignment(const std::size_t byte_alignment)
-{
-  return is_nonzero_power_of_two(byte_alignment) && byte_alignment >= alignof(ElementType);
-}
-
-// We define aligned_pointer_t through a struct
-// so we can check whether the byte alignment is valid.
-// This makes it impossible to use the alias
-// with an invalid byte alignment.
-template<class ElementType, std::size_t byte_alignment>
-struct aligned_pointer {
-  static_assert(valid_byte_alignment<ElementType>(byte_alignment),
-		"byte_alignment must be a power of two no less than "
-		"the minimum required alignment of ElementType.");
-
-#if defined(__ICC)
-  // x86-64 ICC 2021.5.0 emits warning #3186 ("expected typedef declaration") here.
-  // No other compiler (including Clang, which has a similar type attribute) has this issue.
-#  pragma warning push
-#  pragma warning disable 3186
-#endif
-
-  using type = ElementType* _MDSPAN_ALIGN_VALUE_ATTRIBUTE( byte_alignment );
-
-#if defined(__ICC)
-#  pragma warning pop
-#endif
-};
-
-template<class ElementType, std::size_t byte_alignment>
-using aligned_pointer_t = typename aligned_pointer<ElementType, byte_alignment>::type;
-
-template<class ElementType, std::size_t byte_alignment>
-aligned_pointer_t<ElementType, byte_alignment>
-bless(ElementType* ptr, std::integral_constant<std::size_t, byte_alignment> /* ba */ )
-{
-  return _MDSPAN_ASSUME_ALIGNED( ElementType, ptr, byte_alignment );
-}
-
-template<class ElementType, std::size_t byte_alignment>
-struct aligned_accessor {
-  using offset_policy = Kokkos::default_accessor<ElementType>;
-  using element_type = ElementType;
-  using reference = ElementType&;
-  using data_handle_type = aligned_pointer_t<ElementType, byte_alignment>;
-
-  constexpr aligned_accessor() noexcept = default;
-
-  MDSPAN_TEMPLATE_REQUIRES(
-    class OtherElementType,
-    std::size_t other_byte_alignment,
-    /* requires */ (std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value && other_byte_alignment == byte_alignment)
-    )
-  constexpr aligned_accessor(aligned_accessor<OtherElementType, other_byte_alignment>) noexcept {}
-
-  constexpr reference access(data_handle_type p, size_t i) const noexcept {
-    // This may declare alignment twice, depending on
-    // if we have an attribute for marking pointer types.
-    return _MDSPAN_ASSUME_ALIGNED( ElementType, p, byte_alignment )[i];
-  }
-
-  constexpr typename offset_policy::data_handle_type
-  offset(data_handle_type p, size_t i) const noexcept {
-    return p + i;
-  }
-};
-
 template<class ElementType>
 struct delete_raw {
   void operator()(ElementType* p) const {
@@ -244,14 +142,14 @@ public:
     num_elements(number_of_elements)
   {}
 
-  aligned_pointer_t<ElementType, byte_alignment> data() const
+  ElementType* data() const
   {
     return _MDSPAN_ASSUME_ALIGNED( ElementType, pointer, byte_alignment );
   }
 
 private:
   allocation_t<ElementType> allocation{nullptr, delete_raw<ElementType>{}};
-  aligned_pointer_t<ElementType, byte_alignment> pointer{nullptr};
+  ElementType* pointer{nullptr};
   std::size_t num_elements{0};
 };
 
@@ -310,7 +208,7 @@ using aligned_mdspan_1d =
   Kokkos::mdspan<ElementType,
 		Kokkos::dextents<index_type, 1>,
 		Kokkos::layout_right,
-		aligned_accessor<ElementType, byte_alignment>>;
+		Kokkos::Experimental::aligned_accessor<ElementType, byte_alignment>>;
 
 template<class ElementType>
 using mdspan_1d =
@@ -410,10 +308,13 @@ auto benchmark_add_raw_1d(const std::size_t num_trials,
 // Assume that x, y, and z all have the same alignment.
 template<class ElementType, std::size_t byte_alignment>
 void add_aligned_raw_1d(const index_type n,
-			aligned_pointer_t<const ElementType, byte_alignment> x,
-			aligned_pointer_t<const ElementType, byte_alignment> y,
-			aligned_pointer_t<ElementType, byte_alignment> z)
+			const ElementType x_in[],
+			const ElementType y_in[],
+			ElementType z_in[])
 {
+  const ElementType* x = _MDSPAN_ASSUME_ALIGNED( const ElementType, x_in, byte_alignment );
+  const ElementType* y = _MDSPAN_ASSUME_ALIGNED( const ElementType, y_in, byte_alignment );
+  ElementType* z = _MDSPAN_ASSUME_ALIGNED( ElementType, z_in, byte_alignment );
   for (index_type i = 0; i < n; ++i) {
     z[i] = x[i] + y[i];
   }
@@ -426,14 +327,11 @@ auto benchmark_add_aligned_raw_1d(const std::size_t num_trials,
 				  const ElementType x[],
 				  const ElementType y[],
 				  ElementType z[],
-				  std::integral_constant<std::size_t, byte_alignment> ba)
+				  std::integral_constant<std::size_t, byte_alignment> /* ba */ )
 {
   TICK();
-  auto x_blessed = bless(x, ba);
-  auto y_blessed = bless(y, ba);
-  auto z_blessed = bless(z, ba);
   for (std::size_t trial = 0; trial < num_trials; ++trial) {
-    add_aligned_raw_1d<ElementType, byte_alignment>(n, x_blessed, y_blessed, z_blessed);
+    add_aligned_raw_1d<ElementType, byte_alignment>(n, x, y, z);
   }
   return TOCK();
 }
@@ -559,10 +457,13 @@ auto benchmark_add_omp_aligned_simd_raw_1d(const std::size_t num_trials,
 
 template<class ElementType, std::size_t byte_alignment>
 void add_omp_simd_aligned_raw_1d(const index_type n,
-				 aligned_pointer_t<const ElementType, byte_alignment> x,
-				 aligned_pointer_t<const ElementType, byte_alignment> y,
-				 aligned_pointer_t<ElementType, byte_alignment> z)
+				 const ElementType x_in[],
+				 const ElementType y_in[],
+				 ElementType z_in[])
 {
+  const ElementType* x = _MDSPAN_ASSUME_ALIGNED( const ElementType, x_in, byte_alignment );
+  const ElementType* y = _MDSPAN_ASSUME_ALIGNED( const ElementType, y_in, byte_alignment );
+  ElementType* z = _MDSPAN_ASSUME_ALIGNED( ElementType, z_in, byte_alignment );
 #pragma omp simd
   for (index_type i = 0; i < n; ++i) {
     z[i] = x[i] + y[i];
@@ -576,24 +477,24 @@ auto benchmark_add_omp_simd_aligned_raw_1d(const std::size_t num_trials,
 					   const ElementType x[],
 					   const ElementType y[],
 					   ElementType z[],
-					   std::integral_constant<std::size_t, byte_alignment> ba)
+					   std::integral_constant<std::size_t, byte_alignment> /* ba */ )
 {
   TICK();
-  auto x_blessed = bless(x, ba);
-  auto y_blessed = bless(y, ba);
-  auto z_blessed = bless(z, ba);
   for (std::size_t trial = 0; trial < num_trials; ++trial) {
-    add_omp_simd_aligned_raw_1d<ElementType, byte_alignment>(n, x_blessed, y_blessed, z_blessed);
+    add_omp_simd_aligned_raw_1d<ElementType, byte_alignment>(n, x, y, z);
   }
   return TOCK();
 }
 
 template<class ElementType, std::size_t byte_alignment>
 void add_omp_aligned_simd_aligned_raw_1d(const index_type n,
-					 aligned_pointer_t<const ElementType, byte_alignment> x,
-					 aligned_pointer_t<const ElementType, byte_alignment> y,
-					 aligned_pointer_t<ElementType, byte_alignment> z)
+					 const ElementType x_in[],
+					 const ElementType y_in[],
+					 ElementType z_in[])
 {
+  const ElementType* x = _MDSPAN_ASSUME_ALIGNED( const ElementType, x_in, byte_alignment );
+  const ElementType* y = _MDSPAN_ASSUME_ALIGNED( const ElementType, y_in, byte_alignment );
+  ElementType* z = _MDSPAN_ASSUME_ALIGNED( ElementType, z_in, byte_alignment );
 #pragma omp simd aligned(z,x,y:byte_alignment)
   for (index_type i = 0; i < n; ++i) {
     z[i] = x[i] + y[i];
@@ -608,17 +509,14 @@ auto benchmark_add_omp_aligned_simd_aligned_raw_1d(
   const ElementType x[],
   const ElementType y[],
   ElementType z[],
-  std::integral_constant<std::size_t, byte_alignment> ba)
+  std::integral_constant<std::size_t, byte_alignment> /* ba */ )
 {
   TICK();
-  auto x_blessed = bless(x, ba);
-  auto y_blessed = bless(y, ba);
-  auto z_blessed = bless(z, ba);
   for (std::size_t trial = 0; trial < num_trials; ++trial) {
     // Passing in ba doesn't help the compiler
     // deduce the template parameters,
     // so we just specify them explicitly.
-    add_omp_aligned_simd_aligned_raw_1d<ElementType, byte_alignment>(n, x_blessed, y_blessed, z_blessed);
+    add_omp_aligned_simd_aligned_raw_1d<ElementType, byte_alignment>(n, x, y, z);
   }
   return TOCK();
 }
@@ -711,8 +609,6 @@ int main(int argc, char* argv[])
        << "Number of loop iterations per trial: " << n << endl
        << "Way to declare a pointer value aligned, if any: "
        << assume_aligned_method << endl
-       << "Way to declare a pointer type aligned, if any: "
-       << align_attribute_method << endl
        << "Total time in seconds for non-OpenMP loops:" << endl
        << "  aligned mdspan: " << aligned_mdspan_result << endl
        << "  unaligned mdspan: " << mdspan_result << endl
@@ -27,16 +27,6 @@
 namespace {
 
 
-#if defined(_MDSPAN_COMPILER_MSVC) || defined(__INTEL_COMPILER)
-#  define _MDSPAN_RESTRICT_KEYWORD __restrict
-#elif defined(__GNUC__) || defined(__clang__)
-#  define _MDSPAN_RESTRICT_KEYWORD __restrict__
-#else
-#  define _MDSPAN_RESTRICT_KEYWORD
-#endif
-
-#define _MDSPAN_RESTRICT_POINTER( ELEMENT_TYPE ) ELEMENT_TYPE * _MDSPAN_RESTRICT_KEYWORD
-
 // https://en.cppreference.com/w/c/language/restrict gives examples
 // of the kinds of optimizations that may apply to restrict.  For instance,
 // "[r]estricted pointers can be assigned to unrestricted pointers freely,
@@ -64,29 +54,7 @@ namespace {
 // Any use of this keyword is not Standard C++,
 // so you'll have to refer to the compiler's documentation,
 // look at the assembler output, and do performance experiments.
-template<class ElementType>
-struct restrict_accessor {
-  using offset_policy = Kokkos::default_accessor<ElementType>;
-  using element_type = ElementType;
-  using reference = ElementType&;
-  using data_handle_type = _MDSPAN_RESTRICT_POINTER( ElementType );
-
-  constexpr restrict_accessor() noexcept = default;
-
-  MDSPAN_TEMPLATE_REQUIRES(
-    class OtherElementType,
-    /* requires */ (std::is_convertible<OtherElementType(*)[], element_type(*)[]>::value)
-    )
-  constexpr restrict_accessor(restrict_accessor<OtherElementType>) noexcept {}
-
-  constexpr reference access(data_handle_type p, size_t i) const noexcept {
-    return p[i];
-  }
-  constexpr typename offset_policy::data_handle_type
-  offset(data_handle_type p, size_t i) const noexcept {
-    return p + i;
-  }
-};
+using Kokkos::Experimental::restrict_accessor;
 
 // Use int, not size_t, as the index_type.
 // Some compilers have trouble optimizing loops with unsigned or 64-bit index types.
@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+#include "../__p0009_bits/mdspan.hpp"
+
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Read-only accessor converting every element read through NestedAccessor to
+// ElementType, e.g. to read double storage as float without a copy.
+template <class ElementType, class NestedAccessor>
+class converting_accessor {
+public:
+  using element_type = std::add_const_t<ElementType>;
+  using reference = std::remove_cv_t<ElementType>;
+  using data_handle_type = typename NestedAccessor::data_handle_type;
+  using offset_policy =
+      converting_accessor<ElementType, typename NestedAccessor::offset_policy>;
+
+  static_assert(
+      std::is_convertible<typename NestedAccessor::reference, reference>::value,
+      MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+      "::converting_accessor requires the nested reference to be convertible "
+      "to ElementType.");
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr converting_accessor() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr converting_accessor(const NestedAccessor &acc)
+      : nested_accessor_(acc) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherNestedAccessor,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_constructible, NestedAccessor, const OtherNestedAccessor&)
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT(
+    (!std::is_convertible<OtherNestedAccessor, NestedAccessor>::value))
+  MDSPAN_INLINE_FUNCTION
+  constexpr converting_accessor(
+      const converting_accessor<ElementType, OtherNestedAccessor> &other)
+      : nested_accessor_(other.nested_accessor()) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const {
+    return static_cast<reference>(nested_accessor_.access(p, i));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type p, size_t i) const {
+    return nested_accessor_.offset(p, i);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const NestedAccessor &nested_accessor() const noexcept {
+    return nested_accessor_;
+  }
+
+private:
+  NestedAccessor nested_accessor_{};
+};
+
+// Returns a read-only view of x with every element converted to ElementType.
+template <class ElementType, class XElementType, class Extents, class Layout,
+          class Accessor>
+MDSPAN_INLINE_FUNCTION constexpr auto
+converted(mdspan<XElementType, Extents, Layout, Accessor> x) {
+  using accessor_type = converting_accessor<ElementType, Accessor>;
+  return mdspan<typename accessor_type::element_type, Extents, Layout,
+                accessor_type>(x.data_handle(), x.mapping(),
+                               accessor_type(x.accessor()));
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
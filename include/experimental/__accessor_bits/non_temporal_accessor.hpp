@@ -0,0 +1,181 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/macros.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if !defined(_MDSPAN_HAS_STREAMING_STORES)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define _MDSPAN_HAS_STREAMING_STORES 1
+#  else
+#    define _MDSPAN_HAS_STREAMING_STORES 0
+#  endif
+#endif
+
+#if _MDSPAN_HAS_STREAMING_STORES
+#  include <emmintrin.h>
+#endif
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#  define _MDSPAN_STREAMING_STORES_ON_TARGET 0
+#else
+#  define _MDSPAN_STREAMING_STORES_ON_TARGET _MDSPAN_HAS_STREAMING_STORES
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Stores v to *p bypassing the cache hierarchy where the target supports it.
+// x86 only has scalar streaming stores for 4 and 8 byte general purpose
+// registers (movnti), so the bits of v are moved through an integer. Other
+// element types, and other targets, fall back to a plain store.
+template <class T>
+MDSPAN_FORCE_INLINE_FUNCTION inline void
+__non_temporal_store(T *p, const T &v) noexcept {
+#if _MDSPAN_STREAMING_STORES_ON_TARGET
+  if constexpr (std::is_trivially_copyable<T>::value && sizeof(T) == 4 &&
+                alignof(T) == 4) {
+    int bits;
+    std::memcpy(&bits, &v, sizeof(T));
+    _mm_stream_si32(reinterpret_cast<int *>(p), bits);
+    return;
+  }
+#  if defined(__x86_64__) || defined(_M_X64)
+  if constexpr (std::is_trivially_copyable<T>::value && sizeof(T) == 8 &&
+                alignof(T) == 8) {
+    long long bits;
+    std::memcpy(&bits, &v, sizeof(T));
+    _mm_stream_si64(reinterpret_cast<long long *>(p), bits);
+    return;
+  }
+#  endif
+#endif
+  *p = v;
+}
+
+// Proxy reference of non_temporal_accessor: assignments are streaming
+// stores, conversions are ordinary loads.
+template <class ElementType>
+class __non_temporal_reference {
+public:
+  using value_type = std::remove_cv_t<ElementType>;
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  explicit constexpr __non_temporal_reference(ElementType *p) noexcept
+      : ptr_(p) {}
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __non_temporal_reference &operator=(const value_type &v) const noexcept {
+    __non_temporal_store(ptr_, v);
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __non_temporal_reference &
+  operator=(const __non_temporal_reference &other) const noexcept {
+    return *this = static_cast<value_type>(other);
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr operator value_type() const noexcept { return *ptr_; }
+
+private:
+  ElementType *ptr_;
+};
+
+} // namespace detail
+
+// Orders the streaming stores issued so far before any later store. Call it
+// once at the end of a kernel that writes through non_temporal_accessor
+// before the results are handed to another thread.
+MDSPAN_INLINE_FUNCTION
+void non_temporal_fence() noexcept {
+#if _MDSPAN_STREAMING_STORES_ON_TARGET
+  _mm_sfence();
+#elif !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
+  std::atomic_thread_fence(std::memory_order_release);
+#endif
+}
+
+// Accessor for outputs that are written once and not read again soon:
+// assignments through its reference are streaming stores, which don't pollute
+// the caches. Reads are ordinary loads, which see the thread's own stores;
+// other threads are only guaranteed to see them once the storing thread has
+// called non_temporal_fence() and then synchronized with them. For const
+// elements the reference is a plain reference.
+template <class ElementType>
+struct non_temporal_accessor {
+  using offset_policy = non_temporal_accessor;
+  using element_type = ElementType;
+  using reference =
+      std::conditional_t<std::is_const<ElementType>::value, ElementType &,
+                         detail::__non_temporal_reference<ElementType>>;
+  using data_handle_type = ElementType *;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr non_temporal_accessor() noexcept = default;
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr non_temporal_accessor(non_temporal_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr non_temporal_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, element_type(*)[], OtherElementType(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const noexcept {
+    if constexpr (std::is_const<ElementType>::value)
+      return p[i];
+    else
+      return reference(p + i);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,196 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Number of 64 bit words backing n packed booleans.
+MDSPAN_INLINE_FUNCTION
+constexpr size_t packed_bool_words(size_t n) noexcept { return (n + 63) / 64; }
+
+// Pointer to a single bit: bit bit() of *word(). Word is uint64_t, const for
+// read-only access. The bit offset is kept in [0, 64).
+template <class Word>
+class packed_bit_pointer {
+  static_assert(std::is_same<std::remove_const_t<Word>, uint64_t>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::packed_bit_pointer requires 64 bit words.");
+
+public:
+  using word_type = Word;
+  static constexpr size_t word_bits = 64;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr packed_bit_pointer() noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr packed_bit_pointer(word_type *word, size_t bit = 0) noexcept
+      : word_(word + bit / word_bits), bit_(bit % word_bits) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherWord,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherWord*, word_type*)
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr packed_bit_pointer(packed_bit_pointer<OtherWord> other) noexcept
+      : word_(other.word()), bit_(other.bit()) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr word_type *word() const noexcept { return word_; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr size_t bit() const noexcept { return bit_; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr packed_bit_pointer operator+(size_t i) const noexcept {
+    return packed_bit_pointer(word_, bit_ + i);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const packed_bit_pointer &a,
+                                   const packed_bit_pointer &b) noexcept {
+    return a.word_ == b.word_ && a.bit_ == b.bit_;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const packed_bit_pointer &a,
+                                   const packed_bit_pointer &b) noexcept {
+    return !(a == b);
+  }
+
+private:
+  word_type *word_ = nullptr;
+  size_t bit_ = 0;
+};
+
+namespace detail {
+
+MDSPAN_FORCE_INLINE_FUNCTION
+constexpr bool __load_bit(const uint64_t *word, size_t bit) noexcept {
+  return (*word >> bit) & 1u;
+}
+
+// Proxy reference to a single bit. Stores are read-modify-write of the whole
+// word, so concurrent stores to bits sharing a word race.
+class __packed_bit_reference {
+public:
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr __packed_bit_reference(uint64_t *word, size_t bit) noexcept
+      : word_(word), mask_(uint64_t(1) << bit) {}
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr operator bool() const noexcept { return (*word_ & mask_) != 0; }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr const __packed_bit_reference &operator=(bool v) const noexcept {
+    *word_ = v ? (*word_ | mask_) : (*word_ & ~mask_);
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr const __packed_bit_reference &
+  operator=(const __packed_bit_reference &other) const noexcept {
+    return *this = bool(other);
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr const __packed_bit_reference &operator&=(bool v) const noexcept {
+    if (!v)
+      *word_ &= ~mask_;
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr const __packed_bit_reference &operator|=(bool v) const noexcept {
+    if (v)
+      *word_ |= mask_;
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr const __packed_bit_reference &operator^=(bool v) const noexcept {
+    if (v)
+      *word_ ^= mask_;
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr void flip() const noexcept { *word_ ^= mask_; }
+
+private:
+  uint64_t *word_;
+  uint64_t mask_;
+};
+
+} // namespace detail
+
+// Accessor for masks stored one bit per element in 64 bit words, bit i % 64
+// of word i / 64 holding element i. ElementType is bool, or const bool in
+// which case the reference is a plain bool. The data handle carries a bit
+// offset, so submdspans may start anywhere inside a word.
+template <class ElementType>
+struct packed_bool_accessor {
+  static_assert(std::is_same<std::remove_const_t<ElementType>, bool>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::packed_bool_accessor requires bool elements.");
+
+  using offset_policy = packed_bool_accessor;
+  using element_type = ElementType;
+  using word_type =
+      std::conditional_t<std::is_const<ElementType>::value, const uint64_t,
+                         uint64_t>;
+  using data_handle_type = packed_bit_pointer<word_type>;
+  using reference =
+      std::conditional_t<std::is_const<ElementType>::value, bool,
+                         detail::__packed_bit_reference>;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr packed_bool_accessor() noexcept = default;
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr packed_bool_accessor(packed_bool_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const noexcept {
+    const size_t bit = p.bit() + i;
+    if constexpr (std::is_const<ElementType>::value)
+      return detail::__load_bit(p.word() + bit / 64, bit % 64);
+    else
+      return reference(p.word() + bit / 64, bit % 64);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
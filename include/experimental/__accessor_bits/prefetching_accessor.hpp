@@ -0,0 +1,147 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/macros.hpp"
+#include "../__p0009_bits/mdspan.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(_MDSPAN_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+#  include <xmmintrin.h>
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Hints that the cache line holding addr will be read soon. Never faults, so
+// addr may lie outside of the allocation.
+MDSPAN_FORCE_INLINE_FUNCTION inline void
+__prefetch_read(std::uintptr_t addr) noexcept {
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+  (void)addr;
+#elif defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(reinterpret_cast<const void *>(addr), 0, 3);
+#elif defined(_MDSPAN_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_IX86))
+  _mm_prefetch(reinterpret_cast<const char *>(addr), _MM_HINT_T0);
+#else
+  (void)addr;
+#endif
+}
+
+} // namespace detail
+
+// Accessor that prefetches the element prefetch_distance() positions ahead in
+// the codomain of the mapping on every access. Meant for strided traversals,
+// e.g. of layout_stride submdspans, which the hardware prefetchers may fail to
+// follow; see with_prefetch for deriving the distance from a stride.
+template <class ElementType>
+struct prefetching_accessor {
+  using offset_policy = prefetching_accessor;
+  using element_type = ElementType;
+  using reference = ElementType &;
+  using data_handle_type = ElementType *;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr prefetching_accessor() noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr prefetching_accessor(size_t distance) noexcept
+      : distance_(distance) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr prefetching_accessor(prefetching_accessor<OtherElementType> other) noexcept
+      : distance_(other.prefetch_distance()) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr prefetching_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, element_type(*)[], OtherElementType(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr size_t prefetch_distance() const noexcept { return distance_; }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  reference access(data_handle_type p, size_t i) const noexcept {
+    // Integer arithmetic: the prefetched address may be past the end.
+    detail::__prefetch_read(reinterpret_cast<std::uintptr_t>(p + i) +
+                            distance_ * sizeof(element_type));
+    return p[i];
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+
+private:
+  size_t distance_ = 0;
+};
+
+// Number of steps along the traversed dimension that with_prefetch looks
+// ahead by default.
+_MDSPAN_INLINE_VARIABLE constexpr size_t default_prefetch_steps = 16;
+
+// Returns s, which must use default_accessor, with a prefetching_accessor
+// that fetches `steps` iterations ahead of a loop whose innermost index is r,
+// i.e. mapping().stride(r) * steps elements ahead.
+template <class ElementType, class Extents, class LayoutPolicy, class AccessorPolicy>
+mdspan<ElementType, Extents, LayoutPolicy, prefetching_accessor<ElementType>>
+with_prefetch(const mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy> &s,
+              size_t r = Extents::rank() - 1,
+              size_t steps = default_prefetch_steps) {
+  static_assert(Extents::rank() > 0,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::with_prefetch requires an mdspan of rank at least one.");
+  static_assert(LayoutPolicy::template mapping<Extents>::is_always_strided(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::with_prefetch requires a strided layout.");
+  // Other accessors with pointer data handles (conjugated, atomic,
+  // non-temporal, ...) would silently lose their semantics.
+  static_assert(std::is_same<AccessorPolicy, default_accessor<ElementType>>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::with_prefetch requires an mdspan with default_accessor.");
+  return {s.data_handle(), s.mapping(),
+          prefetching_accessor<ElementType>(
+              static_cast<size_t>(s.mapping().stride(r)) * steps)};
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
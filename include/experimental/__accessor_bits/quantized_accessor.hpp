@@ -0,0 +1,258 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//******************************************
+// Storage formats
+//******************************************
+
+// A storage format maps float to a compact storage_type and back:
+//   storage_type encode(float);  float decode(storage_type);
+// and bounds the magnitudes it represents by max_value. Encoding rounds to
+// nearest and saturates.
+
+namespace detail {
+
+MDSPAN_INLINE_FUNCTION uint32_t __float_bits(float f) noexcept {
+  uint32_t bits;
+  std::memcpy(&bits, &f, sizeof(float));
+  return bits;
+}
+
+MDSPAN_INLINE_FUNCTION float __bits_float(uint32_t bits) noexcept {
+  float f;
+  std::memcpy(&f, &bits, sizeof(float));
+  return f;
+}
+
+} // namespace detail
+
+// IEEE 754 binary16.
+struct float16_format {
+  using storage_type = uint16_t;
+  static constexpr float max_value = 65504.f;
+
+  MDSPAN_INLINE_FUNCTION static storage_type encode(float f) noexcept {
+    const uint32_t x = detail::__float_bits(f);
+    const uint32_t sign = (x >> 16) & 0x8000u;
+    const uint32_t abs = x & 0x7fffffffu;
+    if (abs >= 0x7f800000u) // inf and nan, keeping nans quiet
+      return storage_type(sign | 0x7c00u | (abs > 0x7f800000u ? 0x200u : 0u));
+    if (abs >= 0x477ff000u) // rounds to more than max_value
+      return storage_type(sign | 0x7c00u);
+    if (abs < 0x38800000u) {
+      // Subnormal result: the addition rounds abs to a multiple of 2^-24 in
+      // the current rounding mode, leaving the half mantissa in the low bits.
+      const float r = detail::__bits_float(abs) + 0.5f;
+      return storage_type(sign | (detail::__float_bits(r) - 0x3f000000u));
+    }
+    // Rebias the exponent and round the mantissa to 10 bits, ties to even.
+    // A mantissa carry correctly increments the exponent.
+    uint32_t r = abs - 0x38000000u;
+    r += 0xfffu + ((r >> 13) & 1u);
+    return storage_type(sign | (r >> 13));
+  }
+
+  MDSPAN_INLINE_FUNCTION static float decode(storage_type h) noexcept {
+    // Shift exponent and mantissa into place and rebias by multiplying with
+    // 2^112, which also normalizes subnormals. Infinities and nans only need
+    // their exponent saturated. Branch free so that bulk decoding vectorizes.
+    const uint32_t shifted = uint32_t(h & 0x7fffu) << 13;
+    uint32_t r = detail::__float_bits(detail::__bits_float(shifted) *
+                                      detail::__bits_float(0x77800000u));
+    r |= shifted >= 0x0f800000u ? 0x7f800000u : 0u;
+    return detail::__bits_float(r | (uint32_t(h & 0x8000u) << 16));
+  }
+};
+
+// bfloat16: the upper half of an IEEE 754 binary32.
+struct bfloat16_format {
+  using storage_type = uint16_t;
+  static constexpr float max_value = std::numeric_limits<float>::max();
+
+  MDSPAN_INLINE_FUNCTION static storage_type encode(float f) noexcept {
+    const uint32_t x = detail::__float_bits(f);
+    if ((x & 0x7fffffffu) > 0x7f800000u)
+      return storage_type((x >> 16) | 0x40u);
+    return storage_type((x + 0x7fffu + ((x >> 16) & 1u)) >> 16);
+  }
+
+  MDSPAN_INLINE_FUNCTION static float decode(storage_type b) noexcept {
+    return detail::__bits_float(uint32_t(b) << 16);
+  }
+};
+
+// Integers, e.g. int8_t: values are rounded to the nearest integer (ties away
+// from zero) and saturated to the range of Int, NaN encodes as 0.
+template <class Int>
+struct integer_format {
+  static_assert(std::is_integral<Int>::value && sizeof(Int) <= 2,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::integer_format requires an integral type of at most 16 bits.");
+  using storage_type = Int;
+  static constexpr float max_value = float(std::numeric_limits<Int>::max());
+
+  MDSPAN_INLINE_FUNCTION static storage_type encode(float f) noexcept {
+    constexpr float lo = float(std::numeric_limits<Int>::min());
+    if (!(f == f))
+      return storage_type(0);
+    const float r = f < 0.f ? f - 0.5f : f + 0.5f;
+    return r <= lo ? std::numeric_limits<Int>::min()
+           : r >= max_value ? std::numeric_limits<Int>::max()
+                            : storage_type(r);
+  }
+
+  MDSPAN_INLINE_FUNCTION static float decode(storage_type q) noexcept {
+    return float(q);
+  }
+};
+
+// Scale that maps magnitudes up to max_abs onto the range of Format.
+template <class Format, class T>
+MDSPAN_INLINE_FUNCTION T quantization_scale(T max_abs) noexcept {
+  return max_abs > T(0) ? max_abs / T(Format::max_value) : T(1);
+}
+
+//******************************************
+// Accessor
+//******************************************
+
+namespace detail {
+
+// Proxy reference of quantized_accessor: converts to the element type by
+// decoding, assignment encodes.
+template <class ElementType, class Format>
+class __quantized_reference {
+public:
+  using value_type = ElementType;
+  using storage_type = typename Format::storage_type;
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr __quantized_reference(storage_type *p, value_type scale,
+                                  value_type inv_scale) noexcept
+      : ptr_(p), scale_(scale), inv_scale_(inv_scale) {}
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  operator value_type() const noexcept {
+    return scale_ * value_type(Format::decode(*ptr_));
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __quantized_reference &operator=(value_type v) const noexcept {
+    *ptr_ = Format::encode(float(v * inv_scale_));
+    return *this;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __quantized_reference &
+  operator=(const __quantized_reference &other) const noexcept {
+    return *this = value_type(other);
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __quantized_reference &operator+=(value_type v) const noexcept {
+    return *this = value_type(*this) + v;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __quantized_reference &operator-=(value_type v) const noexcept {
+    return *this = value_type(*this) - v;
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  const __quantized_reference &operator*=(value_type v) const noexcept {
+    return *this = value_type(*this) * v;
+  }
+
+private:
+  storage_type *ptr_;
+  value_type scale_;
+  value_type inv_scale_;
+};
+
+} // namespace detail
+
+// Accessor over compact storage: elements are stored as
+// Format::encode(x / scale()) and read back as scale() * Format::decode(q).
+// ElementType is a floating point type, const for read-only views, in which
+// case the reference is a plain value. Submdspans keep the scale.
+template <class ElementType, class Format>
+struct quantized_accessor {
+  using value_type = std::remove_const_t<ElementType>;
+  static_assert(std::is_floating_point<value_type>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::quantized_accessor requires a floating point element type.");
+
+  using offset_policy = quantized_accessor;
+  using element_type = ElementType;
+  using storage_type = typename Format::storage_type;
+  using data_handle_type =
+      std::conditional_t<std::is_const<ElementType>::value,
+                         const storage_type *, storage_type *>;
+  using reference =
+      std::conditional_t<std::is_const<ElementType>::value, value_type,
+                         detail::__quantized_reference<value_type, Format>>;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr quantized_accessor() noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr quantized_accessor(value_type scale) noexcept
+      : scale_(scale), inv_scale_(value_type(1) / scale) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr quantized_accessor(quantized_accessor<OtherElementType, Format> other) noexcept
+      : scale_(other.scale()), inv_scale_(value_type(1) / other.scale()) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr value_type scale() const noexcept { return scale_; }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const noexcept {
+    if constexpr (std::is_const<ElementType>::value)
+      return scale_ * value_type(Format::decode(p[i]));
+    else
+      return reference(p + i, scale_, inv_scale_);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+
+private:
+  value_type scale_ = value_type(1);
+  value_type inv_scale_ = value_type(1);
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
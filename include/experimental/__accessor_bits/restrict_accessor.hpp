@@ -0,0 +1,98 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/macros.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#ifndef _MDSPAN_RESTRICT_KEYWORD
+#  if defined(_MDSPAN_COMPILER_MSVC) || defined(__INTEL_COMPILER)
+#    define _MDSPAN_RESTRICT_KEYWORD __restrict
+#  elif defined(__GNUC__) || defined(__clang__)
+#    define _MDSPAN_RESTRICT_KEYWORD __restrict__
+#  else
+#    define _MDSPAN_RESTRICT_KEYWORD
+#  endif
+#endif
+
+#define _MDSPAN_RESTRICT_POINTER( ELEMENT_TYPE ) ELEMENT_TYPE * _MDSPAN_RESTRICT_KEYWORD
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Accessor whose data handle is a restrict-qualified pointer: the elements of
+// an mdspan using it are not accessed through any other data handle while the
+// mdspan is in use. Compilers can then vectorize loops over several such
+// mdspans without runtime overlap checks.
+//
+// Submdspans fall back to default_accessor, since two slices of the same
+// mdspan may overlap.
+template <class ElementType>
+struct restrict_accessor {
+  using offset_policy = default_accessor<ElementType>;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = _MDSPAN_RESTRICT_POINTER( ElementType );
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr restrict_accessor() noexcept = default;
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr restrict_accessor(restrict_accessor<OtherElementType>) noexcept {}
+
+  // The caller promises that the data handle is not aliased.
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr restrict_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, element_type(*)[], OtherElementType(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const noexcept {
+    return p[i];
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,86 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "utility.hpp"
+#include "../__layout_bits/layout_banded.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+template <class Layout>
+struct __is_layout_banded : std::false_type {};
+
+template <size_t KL, size_t KU>
+struct __is_layout_banded<layout_banded<KL, KU>> : std::true_type {};
+
+} // namespace detail
+
+// y = A * x for a layout_banded A. Only the band is read. Along a row the
+// band elements are KL + KU apart in the band storage; rows away from the
+// corners hold exactly KL + KU + 1 of them, so their dot product has a
+// compile time trip count and unrolls completely.
+template <class AElementType, class AExtents, class ALayout, class AAccessor,
+          class XElementType, class XExtents, class XLayout, class XAccessor,
+          class YElementType, class YExtents, class YLayout, class YAccessor>
+void banded_matrix_vector_product(
+    mdspan<AElementType, AExtents, ALayout, AAccessor> A,
+    mdspan<XElementType, XExtents, XLayout, XAccessor> x,
+    mdspan<YElementType, YExtents, YLayout, YAccessor> y) {
+  static_assert(detail::__is_layout_banded<ALayout>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::banded_matrix_vector_product requires a layout_banded matrix.");
+  static_assert(XExtents::rank() == 1 && YExtents::rank() == 1,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::banded_matrix_vector_product requires rank 1 vectors.");
+  using index_type = typename AExtents::index_type;
+  using value_type = std::remove_cv_t<YElementType>;
+  constexpr index_type width =
+      static_cast<index_type>(ALayout::lower_bandwidth + ALayout::upper_bandwidth + 1);
+  assert(static_cast<size_t>(A.extent(0)) == static_cast<size_t>(y.extent(0)));
+  assert(static_cast<size_t>(A.extent(1)) == static_cast<size_t>(x.extent(0)));
+
+  const auto &map = A.mapping();
+  const auto &acc = A.accessor();
+  const auto p = A.data_handle();
+  const size_t step = static_cast<size_t>(width - 1);
+  auto x_at = [&](index_type j) -> value_type {
+    return x.accessor().access(x.data_handle(), x.mapping()(j));
+  };
+  for (index_type i = 0; i < A.extent(0); ++i) {
+    const auto cols = map.nonzero_columns(i);
+    value_type sum = 0;
+    if (cols.first < cols.second) {
+      const size_t base = static_cast<size_t>(map(i, cols.first));
+      if (cols.second - cols.first == width) {
+        for (index_type t = 0; t < width; ++t)
+          sum += acc.access(p, base + static_cast<size_t>(t) * step) * x_at(cols.first + t);
+      } else {
+        for (index_type t = 0; t < cols.second - cols.first; ++t)
+          sum += acc.access(p, base + static_cast<size_t>(t) * step) * x_at(cols.first + t);
+      }
+    }
+    y.accessor().access(y.data_handle(), y.mapping()(i)) = sum;
+  }
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,422 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "for_each.hpp"
+#include "transpose.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Edge length of the square tiles used when the contiguous dimension of the
+// source is not the contiguous dimension of the destination.
+constexpr size_t __copy_tile_size = 32;
+// Below this many bytes per side the hardware prefetchers keep up with a
+// plain loop nest and tiling only adds overhead.
+constexpr size_t __copy_tile_min_bytes = size_t(1) << 24;
+// Up to this many bytes per side both sides of a transpose fit in L2, where
+// __transpose_2d and its in-register block transposes beat the loop nests.
+// Beyond it the copy is bound by memory traffic and they lose their edge.
+constexpr size_t __copy_transpose_2d_max_bytes = size_t(1) << 20;
+
+//******************************************
+// Copy kernels on raw pointers
+//******************************************
+
+// Copies n elements with the given strides. The unit stride cases are split
+// out so that the compiler sees a plain contiguous loop for them. SPtr and DPtr
+// are pointer types, restrict-qualified when the caller knows that source and
+// destination don't overlap.
+template <class SPtr, class DPtr>
+void __copy_strided_run_impl(SPtr s, size_t ss, DPtr d, size_t ds, size_t n) {
+  if (ss == 1 && ds == 1) {
+    for (size_t i = 0; i < n; ++i)
+      d[i] = s[i];
+  } else if (ds == 1) {
+    for (size_t i = 0; i < n; ++i)
+      d[i] = s[i * ss];
+  } else if (ss == 1) {
+    for (size_t i = 0; i < n; ++i)
+      d[i * ds] = s[i];
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      d[i * ds] = s[i * ss];
+  }
+}
+
+template <bool NoAlias, class S, class D>
+void __copy_strided_run(S *s, size_t ss, D *d, size_t ds, size_t n) {
+  if constexpr (NoAlias)
+    __copy_strided_run_impl<_MDSPAN_RESTRICT_POINTER(S),
+                            _MDSPAN_RESTRICT_POINTER(D)>(s, ss, d, ds, n);
+  else
+    __copy_strided_run_impl<S *, D *>(s, ss, d, ds, n);
+}
+
+template <bool NoAlias, class S, class D>
+void __copy_contiguous(S *s, D *d, size_t n) {
+  if constexpr (std::is_same<std::remove_cv_t<S>, D>::value &&
+                std::is_trivially_copyable<D>::value) {
+    if (n > 0)
+      std::memcpy(d, s, n * sizeof(D));
+  } else {
+    __copy_strided_run<NoAlias>(s, 1, d, 1, n);
+  }
+}
+
+// A permuted strided loop nest, outermost level first.
+template <size_t Rank>
+struct __copy_nest {
+  std::array<size_t, Rank> extents;
+  std::array<size_t, Rank> src_strides;
+  std::array<size_t, Rank> dst_strides;
+};
+
+template <size_t Rank>
+constexpr __copy_nest<Rank>
+__make_copy_nest(const std::array<size_t, Rank> &order,
+                 const std::array<size_t, Rank> &exts,
+                 const std::array<size_t, Rank> &src_strides,
+                 const std::array<size_t, Rank> &dst_strides) noexcept {
+  __copy_nest<Rank> nest{};
+  for (size_t l = 0; l < Rank; ++l) {
+    nest.extents[l] = exts[order[l]];
+    nest.src_strides[l] = src_strides[order[l]];
+    nest.dst_strides[l] = dst_strides[order[l]];
+  }
+  return nest;
+}
+
+// Merges adjacent levels of nest along which both source and destination
+// step through memory with one common stride, see __coalesce_levels. Merged
+// outer levels are left with extent 1.
+template <size_t Rank>
+constexpr __copy_nest<Rank>
+__collapse_copy_nest(const __copy_nest<Rank> &nest) noexcept {
+  __copy_nest<Rank> result = nest;
+  __coalesce_levels(0, result.extents, result.src_strides, result.dst_strides);
+  return result;
+}
+
+template <size_t Level, bool NoAlias, size_t Rank, class S, class D>
+void __copy_nest_loop(const __copy_nest<Rank> &nest, S *s, D *d) {
+  const size_t n = nest.extents[Level];
+  const size_t ss = nest.src_strides[Level];
+  const size_t ds = nest.dst_strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    __copy_strided_run<NoAlias>(s, ss, d, ds, n);
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      __copy_nest_loop<Level + 1, NoAlias>(nest, s + i * ss, d + i * ds);
+  }
+}
+
+// Same as __copy_nest_loop, but the two innermost levels are traversed in
+// square tiles. The last level is expected to be contiguous in the
+// destination and the second to last one contiguous in the source, so that
+// both sides of a tile stay in cache while it is transposed. Consecutive tiles
+// advance along the source's contiguous dimension.
+template <size_t Level, bool NoAlias, size_t Rank, class S, class D>
+void __copy_tiled_loop(const __copy_nest<Rank> &nest, S *s, D *d) {
+  if constexpr (Level + 2 == Rank) {
+    constexpr size_t tile = __copy_tile_size;
+    const size_t na = nest.extents[Level];
+    const size_t nb = nest.extents[Level + 1];
+    const size_t sa = nest.src_strides[Level];
+    const size_t sb = nest.src_strides[Level + 1];
+    const size_t da = nest.dst_strides[Level];
+    const size_t db = nest.dst_strides[Level + 1];
+    for (size_t b0 = 0; b0 < nb; b0 += tile) {
+      const size_t b1 = (std::min)(b0 + tile, nb);
+      for (size_t a0 = 0; a0 < na; a0 += tile) {
+        const size_t a1 = (std::min)(a0 + tile, na);
+        for (size_t a = a0; a < a1; ++a)
+          __copy_strided_run<NoAlias>(s + a * sa + b0 * sb, sb, d + a * da + b0 * db,
+                             db, b1 - b0);
+      }
+    }
+  } else {
+    const size_t n = nest.extents[Level];
+    const size_t ss = nest.src_strides[Level];
+    const size_t ds = nest.dst_strides[Level];
+    for (size_t i = 0; i < n; ++i)
+      __copy_tiled_loop<Level + 1, NoAlias>(nest, s + i * ss, d + i * ds);
+  }
+}
+
+// Same as __copy_nest_loop, but the two innermost levels, which must have
+// unit source and destination stride respectively, are handed to
+// __transpose_2d.
+template <size_t Level, size_t Rank, class S, class D>
+void __copy_transpose_loop(const __copy_nest<Rank> &nest, S *s, D *d) {
+  if constexpr (Level + 2 == Rank) {
+    __transpose_2d(s, nest.src_strides[Level + 1], d, nest.dst_strides[Level],
+                   nest.extents[Level + 1], nest.extents[Level]);
+  } else {
+    const size_t n = nest.extents[Level];
+    const size_t ss = nest.src_strides[Level];
+    const size_t ds = nest.dst_strides[Level];
+    for (size_t i = 0; i < n; ++i)
+      __copy_transpose_loop<Level + 1>(nest, s + i * ss, d + i * ds);
+  }
+}
+
+// Copies a loop nest whose two innermost levels are the contiguous dimensions
+// of source and destination respectively. Arrays that fit in L2 go through
+// __transpose_2d; for larger ones tiling only pays off once they also leave
+// the last level cache.
+template <bool NoAlias, size_t Rank, class S, class D>
+void __copy_transposed(const __copy_nest<Rank> &nest, size_t size, S *s,
+                       D *d) {
+  if (size * sizeof(D) <= __copy_transpose_2d_max_bytes &&
+      nest.src_strides[Rank - 2] == 1 && nest.dst_strides[Rank - 1] == 1) {
+    __copy_transpose_loop<0>(nest, s, d);
+    return;
+  }
+  if (size * sizeof(D) >= __copy_tile_min_bytes)
+    __copy_tiled_loop<0, NoAlias>(nest, s, d);
+  else
+    __copy_nest_loop<0, NoAlias>(nest, s, d);
+}
+
+// Streaming counterpart of __copy_nest_loop for destinations written through
+// non_temporal_accessor.
+template <class S, class D>
+void __copy_streaming_run(S *s, size_t ss, D *d, size_t ds, size_t n) {
+  if (ss == 1 && ds == 1) {
+    size_t i = 0;
+#if _MDSPAN_STREAMING_STORES_ON_TARGET
+    // Scalar streaming stores up to a 16 byte boundary of the destination,
+    // then full 16 byte vectors.
+    if constexpr (std::is_same<std::remove_cv_t<S>, D>::value &&
+                  std::is_trivially_copyable<D>::value &&
+                  (sizeof(D) == 4 || sizeof(D) == 8) &&
+                  alignof(D) == sizeof(D)) {
+      constexpr size_t per_vector = 16 / sizeof(D);
+      for (; i < n && reinterpret_cast<std::uintptr_t>(d + i) % 16 != 0; ++i)
+        __non_temporal_store(d + i, s[i]);
+      for (; i + per_vector <= n; i += per_vector)
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d + i),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i)));
+    }
+#endif
+    for (; i < n; ++i)
+      __non_temporal_store(d + i, static_cast<D>(s[i]));
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      __non_temporal_store(d + i * ds, static_cast<D>(s[i * ss]));
+  }
+}
+
+template <size_t Level, size_t Rank, class S, class D>
+void __copy_streaming_loop(const __copy_nest<Rank> &nest, S *s, D *d) {
+  const size_t n = nest.extents[Level];
+  const size_t ss = nest.src_strides[Level];
+  const size_t ds = nest.dst_strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    __copy_streaming_run(s, ss, d, ds, n);
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      __copy_streaming_loop<Level + 1>(nest, s + i * ss, d + i * ds);
+  }
+}
+
+//******************************************
+// Dispatch on the layout pair
+//******************************************
+
+// Layouts or accessors the kernels can't see through: element-wise copy.
+struct __copy_generic_tag {};
+// Matching exhaustive layouts: one flat loop over the span.
+struct __copy_contiguous_tag {};
+// layout_left meets layout_right: tiled transpose.
+struct __copy_transpose_tag {};
+// At least one side is an arbitrary strided mapping: decided at runtime.
+struct __copy_strided_tag {};
+// The destination uses non_temporal_accessor: streaming stores in destination
+// memory order.
+struct __copy_streaming_tag {};
+
+template <class Src, class Dst>
+struct __copy_dispatch {
+  using src_layout = typename Src::layout_type;
+  using dst_layout = typename Dst::layout_type;
+  static constexpr bool pointer_access =
+      __has_pointer_access_v<Src> && __has_pointer_access_v<Dst>;
+  static constexpr bool strided = Src::mapping_type::is_always_strided() &&
+                                  Dst::mapping_type::is_always_strided();
+  static constexpr bool left_right = __is_left_or_right_v<src_layout> &&
+                                     __is_left_or_right_v<dst_layout>;
+  static constexpr bool no_alias = __no_alias_v<Src, Dst>;
+  static constexpr bool streaming =
+      __has_pointer_access_v<Src> &&
+      __is_non_temporal_accessor<typename Dst::accessor_type>::value;
+  using type = std::conditional_t<
+      !((pointer_access || streaming) && strided), __copy_generic_tag,
+      std::conditional_t<
+          streaming, __copy_streaming_tag,
+          std::conditional_t<
+              left_right && (std::is_same<src_layout, dst_layout>::value ||
+                             Src::rank() <= 1),
+              __copy_contiguous_tag,
+              std::conditional_t<left_right, __copy_transpose_tag,
+                                 __copy_strided_tag>>>>;
+};
+
+template <class Src, class Dst>
+void __copy_impl(const Src &src, const Dst &dst, __copy_generic_tag) {
+  // In the destination's memory order where its mapping is strided.
+  auto f = [&](auto offset, auto... idx) {
+    dst.accessor().access(dst.data_handle(), static_cast<size_t>(offset)) =
+        src.accessor().access(src.data_handle(), src.mapping()(idx...));
+  };
+  for_each_index(dst.mapping(), f);
+}
+
+template <class Src, class Dst>
+void __copy_impl(const Src &src, const Dst &dst, __copy_contiguous_tag) {
+  constexpr bool no_alias = __copy_dispatch<Src, Dst>::no_alias;
+  __copy_contiguous<no_alias>(src.data_handle(), dst.data_handle(), __size(src));
+}
+
+template <class Src, class Dst>
+void __copy_impl(const Src &src, const Dst &dst, __copy_transpose_tag) {
+  constexpr size_t rank = Src::rank();
+  constexpr bool no_alias = __copy_dispatch<Src, Dst>::no_alias;
+  constexpr bool src_is_left =
+      std::is_same<typename Src::layout_type, layout_left>::value;
+  // Outer levels follow the destination order; the two innermost levels are
+  // the contiguous dimension of the source, then that of the destination.
+  std::array<size_t, rank> order{};
+  for (size_t l = 0; l + 2 < rank; ++l)
+    order[l] = src_is_left ? l + 1 : rank - 2 - l;
+  order[rank - 2] = src_is_left ? 0 : rank - 1;
+  order[rank - 1] = src_is_left ? rank - 1 : 0;
+  const auto nest = __make_copy_nest(
+      order, __extents_array(src.mapping()), __strides_array(src.mapping()),
+      __strides_array(dst.mapping()));
+  __copy_transposed<no_alias>(nest, __size(src), src.data_handle(),
+                              dst.data_handle());
+}
+
+template <class Src, class Dst>
+void __copy_impl(const Src &src, const Dst &dst, __copy_strided_tag) {
+  constexpr size_t rank = Src::rank();
+  constexpr bool no_alias = __copy_dispatch<Src, Dst>::no_alias;
+  if constexpr (rank == 0) {
+    *dst.data_handle() = *src.data_handle();
+  } else {
+    const auto exts = __extents_array(src.mapping());
+    const auto src_strides = __strides_array(src.mapping());
+    const auto dst_strides = __strides_array(dst.mapping());
+
+    if (src.mapping().is_exhaustive() && dst.mapping().is_exhaustive() &&
+        src_strides == dst_strides) {
+      __copy_contiguous<no_alias>(src.data_handle(), dst.data_handle(),
+                                  __size(src));
+      return;
+    }
+
+    // Innermost level is the smallest destination stride.
+    std::array<size_t, rank> order{};
+    for (size_t r = 0; r < rank; ++r)
+      order[r] = r;
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+      return dst_strides[a] != dst_strides[b]
+                 ? dst_strides[a] > dst_strides[b]
+                 : src_strides[a] > src_strides[b];
+    });
+
+    // If the source runs fastest along another dimension, make that the
+    // second innermost level so the two can be tiled.
+    if constexpr (rank >= 2) {
+      size_t src_inner = order[rank - 1];
+      for (size_t r = 0; r < rank; ++r)
+        if (exts[r] > 1 && src_strides[r] < src_strides[src_inner])
+          src_inner = r;
+      if (src_inner != order[rank - 1] && exts[order[rank - 1]] > 1) {
+        std::rotate(std::find(order.begin(), order.end(), src_inner),
+                    std::find(order.begin(), order.end(), src_inner) + 1,
+                    order.end() - 1);
+        const auto nest =
+            __make_copy_nest(order, exts, src_strides, dst_strides);
+        __copy_transposed<no_alias>(nest, __size(src), src.data_handle(),
+                                    dst.data_handle());
+        return;
+      }
+    }
+    const auto nest = __collapse_copy_nest(
+        __make_copy_nest(order, exts, src_strides, dst_strides));
+    __copy_nest_loop<0, no_alias>(nest, src.data_handle(), dst.data_handle());
+  }
+}
+
+template <class Src, class Dst>
+void __copy_impl(const Src &src, const Dst &dst, __copy_streaming_tag) {
+  using value_type = typename Dst::value_type;
+  if constexpr (Src::rank() == 0) {
+    __non_temporal_store(dst.data_handle(),
+                         static_cast<value_type>(*src.data_handle()));
+  } else {
+    const auto nest = __collapse_copy_nest(__make_copy_nest(
+        __stride_order(dst.mapping()), __extents_array(src.mapping()),
+        __strides_array(src.mapping()), __strides_array(dst.mapping())));
+    __copy_streaming_loop<0>(nest, src.data_handle(), dst.data_handle());
+  }
+  non_temporal_fence();
+}
+
+} // namespace detail
+
+// Copies every element of src into the element of dst with the same
+// multidimensional index. The loop structure is chosen from the layout pair:
+// matching exhaustive layouts are copied as one contiguous block, layout_left
+// to layout_right (and vice versa) is a tiled transpose, and other strided
+// layouts are traversed with the smallest destination stride innermost. If
+// both sides use restrict_accessor the kernels assume that they don't overlap.
+// A destination using non_temporal_accessor is written with streaming stores,
+// followed by a non_temporal_fence().
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor>
+void copy(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+          mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  using src_type = mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor>;
+  using dst_type = mdspan<DstElementType, DstExtents, DstLayout, DstAccessor>;
+  static_assert(SrcExtents::rank() == DstExtents::rank(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::copy requires source and destination of the same rank.");
+  static_assert(std::is_assignable<typename dst_type::reference,
+                                   typename src_type::reference>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::copy requires assignable element types.");
+  assert(detail::__same_extents(src.extents(), dst.extents()));
+  detail::__copy_impl(
+      src, dst, typename detail::__copy_dispatch<src_type, dst_type>::type{});
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
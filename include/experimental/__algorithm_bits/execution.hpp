@@ -0,0 +1,105 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+#ifndef MDSPAN_USE_STD_EXECUTION
+// Enables overloads taking the standard execution policies. Off by default
+// since <execution> may require linking against a parallel backend (TBB).
+#  define MDSPAN_USE_STD_EXECUTION 0
+#endif
+
+#if MDSPAN_USE_STD_EXECUTION
+#include <execution>
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace execution {
+
+// Runs the algorithm on the calling thread.
+struct sequenced_policy {};
+
+// Splits the outermost dimension of the iteration space across the threads
+// of an OpenMP parallel region. A num_threads of 0 uses omp_get_max_threads().
+// Without OpenMP support this behaves like sequenced_policy.
+struct openmp_policy {
+  int num_threads = 0;
+};
+
+_MDSPAN_INLINE_VARIABLE constexpr sequenced_policy seq{};
+_MDSPAN_INLINE_VARIABLE constexpr openmp_policy openmp{};
+
+} // namespace execution
+
+namespace detail {
+
+// Size of the slots holding per-thread partial results, chosen so that two
+// threads never write to the same cache line.
+constexpr size_t __cache_line_size = 64;
+
+template <class T>
+struct alignas(__cache_line_size) __padded_partial {
+  T value;
+  bool engaged = false;
+};
+
+inline int __openmp_max_threads(const execution::openmp_policy &policy) {
+#if defined(_OPENMP)
+  return policy.num_threads > 0 ? policy.num_threads : omp_get_max_threads();
+#else
+  (void)policy;
+  return 1;
+#endif
+}
+
+inline int __openmp_thread_num() {
+#if defined(_OPENMP)
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+}
+
+inline int __openmp_num_threads() {
+#if defined(_OPENMP)
+  return omp_get_num_threads();
+#else
+  return 1;
+#endif
+}
+
+#if MDSPAN_USE_STD_EXECUTION
+template <class Policy>
+constexpr bool __is_std_execution_policy_v =
+    std::is_execution_policy<std::remove_cv_t<std::remove_reference_t<Policy>>>::value;
+#else
+template <class Policy>
+constexpr bool __is_std_execution_policy_v = false;
+#endif
+
+} // namespace detail
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,287 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "utility.hpp"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+//******************************************
+// Index space traversal with running offsets
+//******************************************
+
+// The loops carry the offset of the current index along: each level adds its
+// stride per iteration and hands its offset to the level inside it, so the
+// mapping is never evaluated.
+
+// Dimensions in order of decreasing stride (Left == false, e.g. layout_right)
+// or increasing stride (Left == true, e.g. layout_left), which covers most
+// strided mappings, in particular submdspans of layout_left and layout_right.
+// The index pack is built in dimension order, appending or prepending.
+template <bool Left, size_t Level, size_t Rank, class IndexType, class F,
+          class... Indices>
+void __for_each_index_ordered(const std::array<size_t, Rank> &exts,
+                              const std::array<size_t, Rank> &strides,
+                              IndexType offset, F &f, Indices... idx) {
+  constexpr size_t dim = Left ? Rank - 1 - Level : Level;
+  const IndexType n = static_cast<IndexType>(exts[dim]);
+  const IndexType stride = static_cast<IndexType>(strides[dim]);
+  if constexpr (Level + 1 == Rank) {
+    if (stride == 1) {
+      for (IndexType i = 0; i < n; ++i) {
+        if constexpr (Left)
+          f(offset + i, i, idx...);
+        else
+          f(offset + i, idx..., i);
+      }
+    } else {
+      for (IndexType i = 0; i < n; ++i, offset += stride) {
+        if constexpr (Left)
+          f(offset, i, idx...);
+        else
+          f(offset, idx..., i);
+      }
+    }
+  } else {
+    for (IndexType i = 0; i < n; ++i, offset += stride) {
+      if constexpr (Left)
+        __for_each_index_ordered<Left, Level + 1>(exts, strides, offset, f, i,
+                                                  idx...);
+      else
+        __for_each_index_ordered<Left, Level + 1>(exts, strides, offset, f,
+                                                  idx..., i);
+    }
+  }
+}
+
+// Any other stride order: the nest is in stride order and idx holds the index
+// in dimension order.
+template <size_t Rank, class IndexType, class F, size_t... R>
+MDSPAN_FORCE_INLINE_FUNCTION inline void
+__invoke_with_index(F &f, IndexType offset,
+                    const std::array<IndexType, Rank> &idx,
+                    std::index_sequence<R...>) {
+  f(offset, idx[R]...);
+}
+
+// Ranks up to __static_order_max_rank get one nest per permutation, Dims
+// listing the dimension of each level from the outermost in, so that every
+// store to idx has a constant position and idx can live in registers.
+constexpr size_t __static_order_max_rank = 4;
+
+template <size_t Level, size_t... Dims, size_t Rank, class IndexType, class F>
+void __for_each_index_permuted(std::index_sequence<Dims...> dims,
+                               const std::array<size_t, Rank> &exts,
+                               const std::array<size_t, Rank> &strides,
+                               std::array<IndexType, Rank> idx,
+                               IndexType offset, F &f) {
+  constexpr size_t dim = std::array<size_t, Rank>{Dims...}[Level];
+  const IndexType n = static_cast<IndexType>(exts[dim]);
+  const IndexType stride = static_cast<IndexType>(strides[dim]);
+  if constexpr (Level + 1 == Rank) {
+    constexpr auto all = std::make_index_sequence<Rank>();
+    if (stride == 1) {
+      for (IndexType i = 0; i < n; ++i) {
+        idx[dim] = i;
+        __invoke_with_index(f, offset + i, idx, all);
+      }
+    } else {
+      for (IndexType i = 0; i < n; ++i, offset += stride) {
+        idx[dim] = i;
+        __invoke_with_index(f, offset, idx, all);
+      }
+    }
+  } else {
+    for (IndexType i = 0; i < n; ++i, offset += stride) {
+      idx[dim] = i;
+      __for_each_index_permuted<Level + 1>(dims, exts, strides, idx, offset,
+                                           f);
+    }
+  }
+}
+
+// Calls g(std::index_sequence<order[0], ..., order[Rank - 1]>()), turning the
+// runtime permutation order into a type by matching one level at a time
+// against the dimensions not chosen yet. Instantiates g for all Rank!
+// permutations.
+template <size_t Rank, class G, size_t... Dims>
+void __with_static_order(const std::array<size_t, Rank> &order, G &g,
+                         std::index_sequence<Dims...> chosen);
+
+template <size_t D, size_t Rank, class G, size_t... Dims>
+void __with_static_order_step(const std::array<size_t, Rank> &order, G &g,
+                              std::index_sequence<Dims...> chosen) {
+  if constexpr (D < Rank) {
+    if constexpr (((D != Dims) && ...)) {
+      if (order[sizeof...(Dims)] == D)
+        return __with_static_order(order, g,
+                                   std::index_sequence<Dims..., D>());
+    }
+    __with_static_order_step<D + 1>(order, g, chosen);
+  }
+}
+
+template <size_t Rank, class G, size_t... Dims>
+void __with_static_order(const std::array<size_t, Rank> &order, G &g,
+                         std::index_sequence<Dims...> chosen) {
+  if constexpr (sizeof...(Dims) == Rank)
+    g(chosen);
+  else
+    __with_static_order_step<0>(order, g, chosen);
+}
+
+// Higher ranks share one nest, order mapping its levels to dimensions at
+// runtime.
+
+template <size_t Level, size_t Rank, class IndexType, class F>
+void __for_each_index_nest_loop(const __strided_nest<Rank> &nest,
+                                const std::array<size_t, Rank> &order,
+                                std::array<IndexType, Rank> idx,
+                                IndexType offset, F &f) {
+  const IndexType n = static_cast<IndexType>(nest.extents[Level]);
+  const IndexType stride = static_cast<IndexType>(nest.strides[Level]);
+  const size_t dim = order[Level];
+  if constexpr (Level + 1 == Rank) {
+    constexpr auto all = std::make_index_sequence<Rank>();
+    if (stride == 1) {
+      for (IndexType i = 0; i < n; ++i) {
+        idx[dim] = i;
+        __invoke_with_index(f, offset + i, idx, all);
+      }
+    } else {
+      for (IndexType i = 0; i < n; ++i, offset += stride) {
+        idx[dim] = i;
+        __invoke_with_index(f, offset, idx, all);
+      }
+    }
+  } else {
+    for (IndexType i = 0; i < n; ++i, offset += stride) {
+      idx[dim] = i;
+      __for_each_index_nest_loop<Level + 1>(nest, order, idx, offset, f);
+    }
+  }
+}
+
+//******************************************
+// Element traversal on raw pointers
+//******************************************
+
+template <size_t Level, size_t Rank, class P, class F>
+void __for_each_nest_loop(const __strided_nest<Rank> &nest, P p, F &f) {
+  const size_t n = nest.extents[Level];
+  const size_t stride = nest.strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    if (stride == 1) {
+      for (size_t i = 0; i < n; ++i)
+        f(p[i]);
+    } else {
+      for (size_t i = 0; i < n; ++i)
+        f(p[i * stride]);
+    }
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      __for_each_nest_loop<Level + 1>(nest, p + i * stride, f);
+  }
+}
+
+} // namespace detail
+
+// Calls f(offset, i...) for every multidimensional index i of map.extents(),
+// where offset == map(i...). Strided mappings are walked in memory order,
+// smallest stride innermost whatever the order of the dimensions, and the
+// offset is carried along by adding strides instead of evaluating map for
+// every index. Other mappings are walked last index fastest.
+template <class Mapping, class F>
+void for_each_index(const Mapping &map, F f) {
+  using extents_type = typename Mapping::extents_type;
+  using index_type = typename extents_type::index_type;
+  constexpr size_t rank = extents_type::rank();
+  if constexpr (!Mapping::is_always_strided()) {
+    auto g = [&](auto... idx) { f(map(idx...), idx...); };
+    detail::__for_each_index_right<0>(map.extents(), g);
+  } else if constexpr (rank == 0) {
+    f(map());
+  } else {
+    using layout_type = typename Mapping::layout_type;
+    const auto exts = detail::__extents_array(map);
+    const auto strides = detail::__strides_array(map);
+    if constexpr (std::is_same<layout_type, layout_right>::value) {
+      detail::__for_each_index_ordered<false, 0>(exts, strides, index_type(0), f);
+    } else if constexpr (std::is_same<layout_type, layout_left>::value) {
+      detail::__for_each_index_ordered<true, 0>(exts, strides, index_type(0), f);
+    } else {
+      // Sorted once per call, so that the smallest stride is innermost.
+      const auto order = detail::__stride_order(map);
+      bool decreasing = true;
+      bool increasing = true;
+      for (size_t l = 0; l < rank; ++l) {
+        decreasing = decreasing && order[l] == l;
+        increasing = increasing && order[l] == rank - 1 - l;
+      }
+      if (decreasing) {
+        detail::__for_each_index_ordered<false, 0>(exts, strides, index_type(0), f);
+      } else if (increasing) {
+        detail::__for_each_index_ordered<true, 0>(exts, strides, index_type(0), f);
+      } else if constexpr (rank <= detail::__static_order_max_rank) {
+        auto g = [&](auto dims) {
+          detail::__for_each_index_permuted<0>(dims, exts, strides,
+                                               std::array<index_type, rank>{},
+                                               index_type(0), f);
+        };
+        detail::__with_static_order(order, g, std::index_sequence<>());
+      } else {
+        detail::__for_each_index_nest_loop<0>(detail::__make_strided_nest(map),
+                                              order, std::array<index_type, rank>{},
+                                              index_type(0), f);
+      }
+    }
+  }
+}
+
+// Calls f(s(i...)) for every multidimensional index i. Strided layouts are
+// traversed in memory order. With pointer accessors, dimensions that are
+// contiguous with each other are merged into a single loop, so that e.g. an
+// exhaustive mdspan is walked by one flat loop; other accessors are handed the
+// offsets of for_each_index. Elements may be modified through the reference
+// passed to f.
+template <class ElementType, class Extents, class Layout, class Accessor,
+          class F>
+void for_each(mdspan<ElementType, Extents, Layout, Accessor> s, F f) {
+  using mdspan_type = mdspan<ElementType, Extents, Layout, Accessor>;
+  constexpr bool fast_path = detail::__has_pointer_access_v<mdspan_type> &&
+                             mdspan_type::mapping_type::is_always_strided();
+  if constexpr (!fast_path) {
+    auto g = [&](auto offset, auto...) {
+      f(s.accessor().access(s.data_handle(), static_cast<size_t>(offset)));
+    };
+    for_each_index(s.mapping(), g);
+  } else if constexpr (Extents::rank() == 0) {
+    f(*s.data_handle());
+  } else {
+    const auto nest = detail::__collapse_strided_nest(
+        detail::__make_strided_nest(s.mapping()));
+    detail::__for_each_nest_loop<0>(nest, s.data_handle(), f);
+  }
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,248 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "utility.hpp"
+#include "../__accessor_bits/packed_bool_accessor.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+template <class Accessor>
+struct __is_packed_bool_accessor : std::false_type {};
+
+template <class ElementType>
+struct __is_packed_bool_accessor<packed_bool_accessor<ElementType>>
+    : std::true_type {};
+
+// Masks whose elements are consecutive bits in the same order for all of
+// MDSpans, so that kernels can run 64 elements at a time.
+template <class MDSpan, class... MDSpans>
+constexpr bool __packed_masks_v =
+    __is_packed_bool_accessor<typename MDSpan::accessor_type>::value &&
+    (__is_packed_bool_accessor<typename MDSpans::accessor_type>::value && ...) &&
+    __is_left_or_right_v<typename MDSpan::layout_type> &&
+    (std::is_same<typename MDSpan::layout_type,
+                  typename MDSpans::layout_type>::value && ...);
+
+//******************************************
+// Word kernels
+//******************************************
+
+MDSPAN_FORCE_INLINE_FUNCTION inline size_t __popcount(uint64_t x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_popcountll(x));
+#else
+  x = x - ((x >> 1) & 0x5555555555555555u);
+  x = (x & 0x3333333333333333u) + ((x >> 2) & 0x3333333333333333u);
+  x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fu;
+  return static_cast<size_t>((x * 0x0101010101010101u) >> 56);
+#endif
+}
+
+MDSPAN_FORCE_INLINE_FUNCTION
+constexpr uint64_t __low_bits(size_t k) noexcept {
+  return k >= 64 ? ~uint64_t(0) : (uint64_t(1) << k) - 1;
+}
+
+// The k bits, 0 < k <= 64, starting at bit off of *p in the low bits of the
+// result. Only touches p[1] if the bits extend into it.
+MDSPAN_FORCE_INLINE_FUNCTION
+inline uint64_t __load_bits(const uint64_t *p, size_t off, size_t k) noexcept {
+  uint64_t v = p[0] >> off;
+  if (off + k > 64)
+    v |= p[1] << (64 - off);
+  return v & __low_bits(k);
+}
+
+inline size_t __mask_count_bits(packed_bit_pointer<const uint64_t> p,
+                                size_t n) noexcept {
+  if (n == 0)
+    return 0;
+  const uint64_t *w = p.word();
+  size_t count = 0;
+  if (p.bit() != 0) {
+    const size_t k = n < 64 - p.bit() ? n : 64 - p.bit();
+    count += __popcount(__load_bits(w, p.bit(), k));
+    n -= k;
+    ++w;
+  }
+  for (; n >= 64; n -= 64)
+    count += __popcount(*w++);
+  if (n > 0)
+    count += __popcount(*w & __low_bits(n));
+  return count;
+}
+
+// d[i] = op(s[i]...) for n bits, 64 at a time. The first and last words of
+// d are merged so that bits outside of the range are preserved. d may be one
+// of the sources but must not partially overlap them.
+template <class Op, class... Src>
+void __mask_apply_bits(Op op, size_t n, packed_bit_pointer<uint64_t> d,
+                       Src... s) {
+  if (n == 0)
+    return;
+  uint64_t *w = d.word();
+  // Align the destination to a word boundary.
+  if (d.bit() != 0) {
+    const size_t k = n < 64 - d.bit() ? n : 64 - d.bit();
+    const uint64_t mask = __low_bits(k) << d.bit();
+    const uint64_t v = op(__load_bits(s.word(), s.bit(), k)...) << d.bit();
+    *w = (*w & ~mask) | (v & mask);
+    n -= k;
+    ++w;
+    ((s = s + k), ...);
+  }
+  const size_t words = n / 64;
+  if (((s.bit() == 0) && ...)) {
+    for (size_t i = 0; i < words; ++i)
+      w[i] = op(s.word()[i]...);
+  } else {
+    for (size_t i = 0; i < words; ++i)
+      w[i] = op(__load_bits(s.word() + i, s.bit(), 64)...);
+  }
+  n -= words * 64;
+  if (n > 0) {
+    w += words;
+    ((s = s + words * 64), ...);
+    const uint64_t mask = __low_bits(n);
+    *w = (*w & ~mask) | (op(__load_bits(s.word(), s.bit(), n)...) & mask);
+  }
+}
+
+template <class Op, class Dst, class... Src>
+void __mask_apply(Op op, const Dst &dst, const Src &... src) {
+  static_assert(
+      !std::is_const<typename Dst::element_type>::value,
+      MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+      "::mask algorithms require a mutable destination.");
+  assert((__same_extents(src.extents(), dst.extents()) && ...));
+  if constexpr (__packed_masks_v<Dst, Src...>) {
+    __mask_apply_bits(op, __size(dst), dst.data_handle(),
+                      packed_bit_pointer<const uint64_t>(src.data_handle())...);
+  } else {
+    auto f = [&](auto... idx) {
+      dst.accessor().access(dst.data_handle(), dst.mapping()(idx...)) =
+          bool(op(uint64_t(bool(src.accessor().access(
+                      src.data_handle(), src.mapping()(idx...))))...) & 1u);
+    };
+    __for_each_index_right<0>(dst.extents(), f);
+  }
+}
+
+struct __mask_and_op {
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr uint64_t operator()(uint64_t a, uint64_t b) const noexcept {
+    return a & b;
+  }
+};
+
+struct __mask_or_op {
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr uint64_t operator()(uint64_t a, uint64_t b) const noexcept {
+    return a | b;
+  }
+};
+
+struct __mask_xor_op {
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr uint64_t operator()(uint64_t a, uint64_t b) const noexcept {
+    return a ^ b;
+  }
+};
+
+struct __mask_not_op {
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr uint64_t operator()(uint64_t a) const noexcept { return ~a; }
+};
+
+} // namespace detail
+
+//******************************************
+// Mask algorithms
+//******************************************
+
+// Element-wise boolean operations and population count over masks of equal
+// extents. For packed_bool_accessor masks sharing a layout_right or
+// layout_left layout they process 64 elements per word operation; any other
+// combination of layouts and accessors falls back to per-element access.
+
+// Number of true elements of m.
+template <class ElementType, class Extents, class Layout, class Accessor>
+size_t mask_count(mdspan<ElementType, Extents, Layout, Accessor> m) {
+  if constexpr (detail::__packed_masks_v<decltype(m)>) {
+    return detail::__mask_count_bits(m.data_handle(), detail::__size(m));
+  } else {
+    size_t count = 0;
+    auto f = [&](auto... idx) {
+      count += bool(m.accessor().access(m.data_handle(), m.mapping()(idx...)));
+    };
+    detail::__for_each_index_right<0>(m.extents(), f);
+    return count;
+  }
+}
+
+// dst = a & b
+template <class AElementType, class AExtents, class ALayout, class AAccessor,
+          class BElementType, class BExtents, class BLayout, class BAccessor,
+          class DstElementType, class DstExtents, class DstLayout,
+          class DstAccessor>
+void mask_and(mdspan<AElementType, AExtents, ALayout, AAccessor> a,
+              mdspan<BElementType, BExtents, BLayout, BAccessor> b,
+              mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  detail::__mask_apply(detail::__mask_and_op{}, dst, a, b);
+}
+
+// dst = a | b
+template <class AElementType, class AExtents, class ALayout, class AAccessor,
+          class BElementType, class BExtents, class BLayout, class BAccessor,
+          class DstElementType, class DstExtents, class DstLayout,
+          class DstAccessor>
+void mask_or(mdspan<AElementType, AExtents, ALayout, AAccessor> a,
+             mdspan<BElementType, BExtents, BLayout, BAccessor> b,
+             mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  detail::__mask_apply(detail::__mask_or_op{}, dst, a, b);
+}
+
+// dst = a ^ b
+template <class AElementType, class AExtents, class ALayout, class AAccessor,
+          class BElementType, class BExtents, class BLayout, class BAccessor,
+          class DstElementType, class DstExtents, class DstLayout,
+          class DstAccessor>
+void mask_xor(mdspan<AElementType, AExtents, ALayout, AAccessor> a,
+              mdspan<BElementType, BExtents, BLayout, BAccessor> b,
+              mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  detail::__mask_apply(detail::__mask_xor_op{}, dst, a, b);
+}
+
+// dst = !src
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor>
+void mask_not(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+              mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  detail::__mask_apply(detail::__mask_not_op{}, dst, src);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
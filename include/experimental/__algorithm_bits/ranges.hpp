@@ -0,0 +1,493 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "utility.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//******************************************
+// Index ranges
+//******************************************
+
+// Random access iterator over the multidimensional indices of Extents, last
+// index fastest. Dereferencing yields the index by value, like the iterators
+// of a counting range, so the parallel algorithms of the standard library can
+// split the index space into chunks. Incrementing carries the index along,
+// jumps recompute it from the linear position.
+template <class Extents>
+class index_iterator {
+public:
+  using extents_type = Extents;
+  using index_type = typename Extents::index_type;
+  using value_type = std::array<index_type, Extents::rank()>;
+  using reference = value_type;
+  using pointer = void;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+#if MDSPAN_HAS_CXX_20
+  using iterator_concept = std::random_access_iterator_tag;
+#endif
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr index_iterator() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator(const extents_type &exts, difference_type pos) noexcept
+      : __exts(exts), __pos(pos), __idx{} {
+    __set_index();
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference operator*() const noexcept { return __idx; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator &operator++() noexcept {
+    ++__pos;
+    if constexpr (Extents::rank() > 0) {
+      for (size_t r = Extents::rank() - 1; r > 0; --r) {
+        if (++__idx[r] < __exts.extent(r))
+          return *this;
+        __idx[r] = 0;
+      }
+      ++__idx[0];
+    }
+    return *this;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator &operator--() noexcept {
+    --__pos;
+    if constexpr (Extents::rank() > 0) {
+      for (size_t r = Extents::rank() - 1; r > 0; --r) {
+        if (__idx[r] > 0) {
+          --__idx[r];
+          return *this;
+        }
+        __idx[r] = __exts.extent(r) - 1;
+      }
+      --__idx[0];
+    }
+    return *this;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator operator++(int) noexcept {
+    index_iterator tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator operator--(int) noexcept {
+    index_iterator tmp = *this;
+    --*this;
+    return tmp;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator &operator+=(difference_type n) noexcept {
+    __pos += n;
+    __set_index();
+    return *this;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_iterator &operator-=(difference_type n) noexcept {
+    return *this += -n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr index_iterator operator+(index_iterator it,
+                                            difference_type n) noexcept {
+    return it += n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr index_iterator operator+(difference_type n,
+                                            index_iterator it) noexcept {
+    return it += n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr index_iterator operator-(index_iterator it,
+                                            difference_type n) noexcept {
+    return it -= n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr difference_type operator-(const index_iterator &a,
+                                             const index_iterator &b) noexcept {
+    return a.__pos - b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const index_iterator &a,
+                                   const index_iterator &b) noexcept {
+    return a.__pos == b.__pos;
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const index_iterator &a,
+                                   const index_iterator &b) noexcept {
+    return a.__pos != b.__pos;
+  }
+#endif
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator<(const index_iterator &a,
+                                  const index_iterator &b) noexcept {
+    return a.__pos < b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator>(const index_iterator &a,
+                                  const index_iterator &b) noexcept {
+    return a.__pos > b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator<=(const index_iterator &a,
+                                   const index_iterator &b) noexcept {
+    return a.__pos <= b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator>=(const index_iterator &a,
+                                   const index_iterator &b) noexcept {
+    return a.__pos >= b.__pos;
+  }
+
+private:
+  // A position past the first one implies that no extent is zero.
+  MDSPAN_INLINE_FUNCTION
+  constexpr void __set_index() noexcept {
+    if constexpr (Extents::rank() > 0) {
+      if (__pos == 0) {
+        for (size_t r = 0; r < Extents::rank(); ++r)
+          __idx[r] = 0;
+        return;
+      }
+      size_t q = static_cast<size_t>(__pos);
+      for (size_t r = Extents::rank() - 1; r > 0; --r) {
+        const size_t e = static_cast<size_t>(__exts.extent(r));
+        __idx[r] = static_cast<index_type>(q % e);
+        q /= e;
+      }
+      __idx[0] = static_cast<index_type>(q);
+    }
+  }
+
+  extents_type __exts{};
+  difference_type __pos = 0;
+  value_type __idx{};
+};
+
+// The index space of Extents as a random access range of
+// std::array<index_type, rank>, last index fastest, i.e. the cartesian
+// product of [0, extent(r)). A rank 0 index space holds one empty index.
+template <class Extents>
+class index_range {
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<Extents>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::index_range's template argument must be a specialization of "
+                MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+
+public:
+  using extents_type = Extents;
+  using iterator = index_iterator<Extents>;
+  using value_type = typename iterator::value_type;
+  using difference_type = typename iterator::difference_type;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr index_range() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr explicit index_range(const extents_type &exts) noexcept
+      : __exts(exts) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __exts; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr size_t size() const noexcept {
+    size_t n = 1;
+    for (size_t r = 0; r < Extents::rank(); ++r)
+      n *= static_cast<size_t>(__exts.extent(r));
+    return n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr bool empty() const noexcept { return size() == 0; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr iterator begin() const noexcept { return iterator(__exts, 0); }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr iterator end() const noexcept {
+    return iterator(__exts, static_cast<difference_type>(size()));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr value_type operator[](size_t i) const noexcept {
+    return *iterator(__exts, static_cast<difference_type>(i));
+  }
+
+private:
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __exts{};
+};
+
+#if defined(_MDSPAN_USE_CLASS_TEMPLATE_ARGUMENT_DEDUCTION)
+template <class IndexType, size_t... Extents>
+index_range(const extents<IndexType, Extents...> &)
+    -> index_range<extents<IndexType, Extents...>>;
+#endif
+
+// All indices of exts, e.g.
+//   auto r = indices(s.extents());
+//   std::for_each(std::execution::par_unseq, r.begin(), r.end(),
+//                 [=](auto idx) { s[idx] = 0; });
+template <class IndexType, size_t... Extents>
+MDSPAN_INLINE_FUNCTION constexpr index_range<extents<IndexType, Extents...>>
+indices(const extents<IndexType, Extents...> &exts) noexcept {
+  return index_range<extents<IndexType, Extents...>>(exts);
+}
+
+template <class ElementType, class Extents, class Layout, class Accessor>
+MDSPAN_INLINE_FUNCTION constexpr index_range<Extents>
+indices(const mdspan<ElementType, Extents, Layout, Accessor> &s) noexcept {
+  return index_range<Extents>(s.extents());
+}
+
+//******************************************
+// Element ranges
+//******************************************
+
+// Random access iterator over the codomain [0, n) of a mapping, accessing
+// every offset through Accessor.
+template <class Accessor>
+class element_iterator {
+public:
+  using accessor_type = Accessor;
+  using data_handle_type = typename Accessor::data_handle_type;
+  using value_type = std::remove_cv_t<typename Accessor::element_type>;
+  using reference = typename Accessor::reference;
+  using pointer = void;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::random_access_iterator_tag;
+#if MDSPAN_HAS_CXX_20
+  using iterator_concept = std::random_access_iterator_tag;
+#endif
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr element_iterator() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator(const data_handle_type &p, const accessor_type &acc,
+                             difference_type pos)
+      : __p(p), __acc(acc), __pos(pos) {}
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference operator*() const {
+    return __acc.access(__p, static_cast<size_t>(__pos));
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference operator[](difference_type n) const {
+    return __acc.access(__p, static_cast<size_t>(__pos + n));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator &operator++() noexcept { ++__pos; return *this; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator &operator--() noexcept { --__pos; return *this; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator operator++(int) noexcept {
+    element_iterator tmp = *this;
+    ++__pos;
+    return tmp;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator operator--(int) noexcept {
+    element_iterator tmp = *this;
+    --__pos;
+    return tmp;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator &operator+=(difference_type n) noexcept {
+    __pos += n;
+    return *this;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr element_iterator &operator-=(difference_type n) noexcept {
+    __pos -= n;
+    return *this;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr element_iterator operator+(element_iterator it,
+                                              difference_type n) noexcept {
+    return it += n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr element_iterator operator+(difference_type n,
+                                              element_iterator it) noexcept {
+    return it += n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr element_iterator operator-(element_iterator it,
+                                              difference_type n) noexcept {
+    return it -= n;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr difference_type operator-(const element_iterator &a,
+                                             const element_iterator &b) noexcept {
+    return a.__pos - b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const element_iterator &a,
+                                   const element_iterator &b) noexcept {
+    return a.__pos == b.__pos;
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const element_iterator &a,
+                                   const element_iterator &b) noexcept {
+    return a.__pos != b.__pos;
+  }
+#endif
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator<(const element_iterator &a,
+                                  const element_iterator &b) noexcept {
+    return a.__pos < b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator>(const element_iterator &a,
+                                  const element_iterator &b) noexcept {
+    return a.__pos > b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator<=(const element_iterator &a,
+                                   const element_iterator &b) noexcept {
+    return a.__pos <= b.__pos;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator>=(const element_iterator &a,
+                                   const element_iterator &b) noexcept {
+    return a.__pos >= b.__pos;
+  }
+
+private:
+  data_handle_type __p{};
+  _MDSPAN_NO_UNIQUE_ADDRESS accessor_type __acc{};
+  difference_type __pos = 0;
+};
+
+// The elements of an exhaustive mdspan in memory order, i.e. in the order of
+// their offsets, not of their indices. Pointer accessors give a contiguous
+// range whose iterators are plain pointers; other accessors go through
+// element_iterator.
+template <class MDSpan>
+class element_range {
+public:
+  static constexpr bool is_contiguous = detail::__has_pointer_access_v<MDSpan>;
+
+  using iterator =
+      std::conditional_t<is_contiguous, typename MDSpan::element_type *,
+                         element_iterator<typename MDSpan::accessor_type>>;
+  using reference = typename MDSpan::reference;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr explicit element_range(const MDSpan &s)
+      : __s(s), __size(static_cast<size_t>(s.mapping().required_span_size())) {
+    assert(s.is_exhaustive());
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr size_t size() const noexcept { return __size; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr bool empty() const noexcept { return __size == 0; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr iterator begin() const { return __make_iterator(0); }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr iterator end() const { return __make_iterator(__size); }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference operator[](size_t i) const {
+    return __s.accessor().access(__s.data_handle(), i);
+  }
+
+  // Only for contiguous ranges.
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename MDSpan::element_type *data() const noexcept {
+    static_assert(is_contiguous,
+                  MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                  "::element_range::data requires a pointer accessor.");
+    return __s.data_handle();
+  }
+
+private:
+  MDSPAN_INLINE_FUNCTION
+  constexpr iterator __make_iterator(size_t i) const {
+    if constexpr (is_contiguous)
+      return __s.data_handle() + i;
+    else
+      return iterator(__s.data_handle(), __s.accessor(),
+                      static_cast<std::ptrdiff_t>(i));
+  }
+
+  MDSpan __s;
+  size_t __size;
+};
+
+// All elements of s in memory order. Requires s.is_exhaustive(), which always
+// holds for layout_left and layout_right and is asserted for other layouts.
+template <class ElementType, class Extents, class Layout, class Accessor>
+MDSPAN_INLINE_FUNCTION constexpr auto
+elements(const mdspan<ElementType, Extents, Layout, Accessor> &s) {
+  return element_range<mdspan<ElementType, Extents, Layout, Accessor>>(s);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,259 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "execution.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cstddef>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#if MDSPAN_USE_STD_EXECUTION
+#include <algorithm>
+#include <thread>
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+//******************************************
+// Reduction kernels on raw pointers
+//******************************************
+
+template <size_t Level, size_t Rank, class P, class T, class Op>
+T __reduce_nest_loop(const __strided_nest<Rank> &nest, P p, T acc, Op &op) {
+  const size_t n = nest.extents[Level];
+  const size_t stride = nest.strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    if (stride == 1) {
+      for (size_t i = 0; i < n; ++i)
+        acc = op(acc, p[i]);
+    } else {
+      for (size_t i = 0; i < n; ++i)
+        acc = op(acc, p[i * stride]);
+    }
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      acc = __reduce_nest_loop<Level + 1>(nest, p + i * stride, acc, op);
+  }
+  return acc;
+}
+
+// Reduces a non-empty nest without an initial value: the accumulator is
+// seeded with the first element, so op never sees anything but elements and
+// partial results.
+template <class T, size_t Level, size_t Rank, class P, class Op>
+T __reduce_nest_first(const __strided_nest<Rank> &nest, P p, Op &op) {
+  const size_t n = nest.extents[Level];
+  const size_t stride = nest.strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    T acc = p[0];
+    for (size_t i = 1; i < n; ++i)
+      acc = op(acc, p[i * stride]);
+    return acc;
+  } else {
+    T acc = __reduce_nest_first<T, Level + 1>(nest, p, op);
+    for (size_t i = 1; i < n; ++i)
+      acc = __reduce_nest_loop<Level + 1>(nest, p + i * stride, acc, op);
+    return acc;
+  }
+}
+
+//******************************************
+// Reduction over slices of the outer loop
+//******************************************
+
+// Reduces the slices [begin, end) of the outermost loop of a non-empty mdspan
+// of rank >= 1 into a partial result. Strided layouts with pointer accessors
+// are traversed in memory order, so the outermost loop is the dimension with
+// the largest stride. Anything else is traversed with dimension 0 outermost
+// through the mapping and accessor.
+template <class T, class MDSpan, class Op>
+struct __mdspan_reducer {
+  static constexpr size_t rank = MDSpan::rank();
+  static constexpr bool fast_path = __has_pointer_access_v<MDSpan> &&
+                                    MDSpan::mapping_type::is_always_strided();
+
+  MDSpan s;
+  Op op;
+  __strided_nest<rank> nest;
+
+  __mdspan_reducer(const MDSpan &s_, const Op &op_) : s(s_), op(op_), nest{} {
+    // The outer level is the one split into slices, the others are merged
+    // where they are contiguous.
+    if constexpr (fast_path)
+      nest = __collapse_strided_nest(__make_strided_nest(s.mapping()), 1);
+    else
+      nest.extents = __extents_array(s.mapping());
+  }
+
+  size_t outer_extent() const noexcept { return nest.extents[0]; }
+
+  void operator()(size_t begin, size_t end, __padded_partial<T> &out) const {
+    if (begin >= end)
+      return;
+    Op f = op;
+    if constexpr (fast_path) {
+      __strided_nest<rank> chunk = nest;
+      chunk.extents[0] = end - begin;
+      auto p = s.data_handle() + begin * nest.strides[0];
+      if (out.engaged) {
+        out.value = __reduce_nest_loop<0>(chunk, p, out.value, f);
+      } else {
+        out.value = __reduce_nest_first<T, 0>(chunk, p, f);
+        out.engaged = true;
+      }
+    } else {
+      using index_type = typename MDSpan::index_type;
+      auto g = [&](auto... idx) {
+        if (out.engaged) {
+          out.value = f(out.value, s.accessor().access(s.data_handle(),
+                                                       s.mapping()(idx...)));
+        } else {
+          out.value = s.accessor().access(s.data_handle(), s.mapping()(idx...));
+          out.engaged = true;
+        }
+      };
+      for (size_t i = begin; i < end; ++i)
+        __for_each_index_right<1>(s.extents(), g, static_cast<index_type>(i));
+    }
+  }
+};
+
+//******************************************
+// Backends
+//******************************************
+
+template <class T, class Reducer>
+std::vector<__padded_partial<T>>
+__reduce_partials(const execution::sequenced_policy &, const Reducer &reducer,
+                  const T &init) {
+  std::vector<__padded_partial<T>> partials(1, __padded_partial<T>{init});
+  reducer(0, reducer.outer_extent(), partials[0]);
+  return partials;
+}
+
+template <class T, class Reducer>
+std::vector<__padded_partial<T>>
+__reduce_partials(const execution::openmp_policy &policy,
+                  const Reducer &reducer, const T &init) {
+  const int max_threads = __openmp_max_threads(policy);
+  std::vector<__padded_partial<T>> partials(max_threads,
+                                            __padded_partial<T>{init});
+  __padded_partial<T> *slots = partials.data();
+  const size_t n = reducer.outer_extent();
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(max_threads)
+#endif
+  {
+    const size_t t = static_cast<size_t>(__openmp_thread_num());
+    const size_t nt = static_cast<size_t>(__openmp_num_threads());
+    reducer(n * t / nt, n * (t + 1) / nt, slots[t]);
+  }
+  return partials;
+}
+
+#if MDSPAN_USE_STD_EXECUTION
+template <class ExecutionPolicy, class T, class Reducer,
+          std::enable_if_t<__is_std_execution_policy_v<ExecutionPolicy>,
+                           int> = 0>
+std::vector<__padded_partial<T>>
+__reduce_partials(ExecutionPolicy &&policy, const Reducer &reducer,
+                  const T &init) {
+  // A few chunks per hardware thread so the backend can balance the load.
+  const size_t n = reducer.outer_extent();
+  const size_t nchunks = (std::min)(
+      n, 4 * (std::max)(size_t(1), size_t(std::thread::hardware_concurrency())));
+  std::vector<__padded_partial<T>> partials(nchunks,
+                                            __padded_partial<T>{init});
+  std::vector<size_t> chunks(nchunks);
+  std::iota(chunks.begin(), chunks.end(), size_t(0));
+  __padded_partial<T> *slots = partials.data();
+  std::for_each(std::forward<ExecutionPolicy>(policy), chunks.begin(),
+                chunks.end(), [&](size_t c) {
+                  reducer(n * c / nchunks, n * (c + 1) / nchunks, slots[c]);
+                });
+  return partials;
+}
+#endif
+
+template <class Policy, class MDSpan, class T, class Op>
+T __reduce(Policy &&policy, const MDSpan &s, T init, Op op) {
+  if constexpr (MDSpan::rank() == 0) {
+    return op(init, s.accessor().access(s.data_handle(), s.mapping()()));
+  } else {
+    if (__size(s) == 0)
+      return init;
+    const __mdspan_reducer<T, MDSpan, Op> reducer(s, op);
+    const auto partials =
+        __reduce_partials(std::forward<Policy>(policy), reducer, init);
+    // Combine in slot order so the result does not depend on scheduling.
+    for (const auto &partial : partials)
+      if (partial.engaged)
+        init = op(init, partial.value);
+    return init;
+  }
+}
+
+} // namespace detail
+
+// Reduces all elements of s with op, starting from init. As for std::reduce,
+// op must be associative and commutative: elements are visited in memory
+// order, and parallel policies split the outermost loop into slices whose
+// partial results are combined at the end.
+template <class ElementType, class Extents, class Layout, class Accessor,
+          class T, class BinaryOp>
+T reduce(execution::sequenced_policy policy,
+         mdspan<ElementType, Extents, Layout, Accessor> s, T init,
+         BinaryOp op) {
+  return detail::__reduce(policy, s, init, op);
+}
+
+template <class ElementType, class Extents, class Layout, class Accessor,
+          class T, class BinaryOp>
+T reduce(execution::openmp_policy policy,
+         mdspan<ElementType, Extents, Layout, Accessor> s, T init,
+         BinaryOp op) {
+  return detail::__reduce(policy, s, init, op);
+}
+
+#if MDSPAN_USE_STD_EXECUTION
+MDSPAN_TEMPLATE_REQUIRES(
+  class ExecutionPolicy, class ElementType, class Extents, class Layout,
+  class Accessor, class T, class BinaryOp,
+  /* requires */ (detail::__is_std_execution_policy_v<ExecutionPolicy>)
+)
+T reduce(ExecutionPolicy &&policy,
+         mdspan<ElementType, Extents, Layout, Accessor> s, T init,
+         BinaryOp op) {
+  return detail::__reduce(std::forward<ExecutionPolicy>(policy), s, init, op);
+}
+#endif
+
+template <class ElementType, class Extents, class Layout, class Accessor,
+          class T, class BinaryOp>
+T reduce(mdspan<ElementType, Extents, Layout, Accessor> s, T init,
+         BinaryOp op) {
+  return detail::__reduce(execution::seq, s, init, op);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,60 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "../__p1684_bits/mdarray.hpp"
+#include "copy.hpp"
+
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Stores the elements of src in dst, which views the same index space through
+// another layout. This is copy(src, dst) restricted to a common element type.
+// Layouts whose contiguous dimensions differ, e.g. layout_left and
+// layout_right, are transposed: arrays that fit in L2 by a cache oblivious
+// recursion whose leaves transpose blocks of 4 byte elements in SIMD
+// registers, larger ones by the loop nests of copy.
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor>
+void relayout(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+              mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst) {
+  static_assert(std::is_same<std::remove_cv_t<SrcElementType>,
+                             DstElementType>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::relayout requires source and destination of the same "
+                "element type.");
+  copy(src, dst);
+}
+
+// Returns a copy of a stored in layout Layout, e.g.
+// relayout<layout_right>(a) for a layout_left mdarray a. Unlike the converting
+// constructor of mdarray, which copies the container as is, this reorders the
+// elements so that every multidimensional index keeps its value.
+template <class Layout, class ElementType, class Extents, class LayoutPolicy,
+          class Container>
+mdarray<ElementType, Extents, Layout, Container>
+relayout(const mdarray<ElementType, Extents, LayoutPolicy, Container> &a) {
+  mdarray<ElementType, Extents, Layout, Container> result(a.extents());
+  relayout(a.to_mdspan(), result.to_mdspan());
+  return result;
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,445 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "execution.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Bytes of source and destination planes a sweep may keep in flight, roughly
+// the L2 cache of one core.
+constexpr size_t __stencil_cache_bytes = size_t(1) << 20;
+// Number of time steps stencil_iterate fuses into one wavefront.
+constexpr size_t __stencil_temporal_depth = 4;
+
+//******************************************
+// Neighborhoods
+//******************************************
+
+// Neighborhood of a grid point of a layout_left or layout_right source:
+// n(di, dj, dk) is src(i + di, j + dj, k + dk). The contiguous dimension has
+// unit stride, so box stencils over it vectorize. The point is kept as an
+// index into its row rather than as a pointer, which GCC fails to vectorize.
+template <bool Left, class T>
+struct __stencil_neighborhood_strided {
+  T *row;
+  ptrdiff_t i;
+  ptrdiff_t stride_mid;
+  ptrdiff_t stride_slow;
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  T &operator()(ptrdiff_t di, ptrdiff_t dj, ptrdiff_t dk) const noexcept {
+    if constexpr (Left)
+      return (row + (dj * stride_mid + dk * stride_slow))[i + di];
+    else
+      return (row + (di * stride_slow + dj * stride_mid))[i + dk];
+  }
+};
+
+// Neighborhood of a grid point of any other source, going through its
+// mapping and accessor.
+template <class MDSpan>
+struct __stencil_neighborhood_generic {
+  using index_type = typename MDSpan::index_type;
+  const MDSpan &s;
+  index_type i, j, k;
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  typename MDSpan::reference operator()(ptrdiff_t di, ptrdiff_t dj,
+                                        ptrdiff_t dk) const {
+    return s.accessor().access(
+        s.data_handle(),
+        s.mapping()(static_cast<index_type>(i + di),
+                    static_cast<index_type>(j + dj),
+                    static_cast<index_type>(k + dk)));
+  }
+};
+
+//******************************************
+// Box stencils
+//******************************************
+
+// Sum over the (2 Radius + 1)^3 box around each point, unrolled at compile
+// time so that the row loop around it still vectorizes for boxes too large
+// for the compiler's own complete unrolling.
+template <size_t Radius>
+struct __box_sum {
+  template <class Neighborhood, size_t... I>
+  MDSPAN_FORCE_INLINE_FUNCTION static auto
+  __sum(const Neighborhood &n, std::index_sequence<I...>) {
+    constexpr ptrdiff_t r = Radius;
+    constexpr size_t w = 2 * Radius + 1;
+    std::remove_cv_t<std::remove_reference_t<decltype(n(0, 0, 0))>> sum = 0;
+    ((sum += n(ptrdiff_t(I / (w * w)) - r, ptrdiff_t(I / w % w) - r,
+               ptrdiff_t(I % w) - r)),
+     ...);
+    return sum;
+  }
+
+  template <class Neighborhood>
+  MDSPAN_FORCE_INLINE_FUNCTION auto operator()(const Neighborhood &n) const {
+    constexpr size_t w = 2 * Radius + 1;
+    return __sum(n, std::make_index_sequence<w * w * w>());
+  }
+};
+
+struct __box_sum_dynamic {
+  ptrdiff_t r;
+
+  template <class Neighborhood>
+  auto operator()(const Neighborhood &n) const {
+    std::remove_cv_t<std::remove_reference_t<decltype(n(0, 0, 0))>> sum = 0;
+    for (ptrdiff_t di = -r; di <= r; ++di)
+      for (ptrdiff_t dj = -r; dj <= r; ++dj)
+        for (ptrdiff_t dk = -r; dk <= r; ++dk)
+          sum += n(di, dj, dk);
+    return sum;
+  }
+};
+
+// Calls g with the box sum functor of the given radius, the common radii
+// being compile time constants so that the box loops unroll.
+template <class G>
+void __with_box_sum(size_t radius, G &&g) {
+  switch (radius) {
+  case 0: g(__box_sum<0>()); break;
+  case 1: g(__box_sum<1>()); break;
+  case 2: g(__box_sum<2>()); break;
+  case 3: g(__box_sum<3>()); break;
+  default: g(__box_sum_dynamic{static_cast<ptrdiff_t>(radius)}); break;
+  }
+}
+
+//******************************************
+// Blocked sweeps over layout_left and layout_right
+//******************************************
+
+// The grid in loop order: planes along the dimension with the largest stride
+// are streamed through, tiles split the middle dimension and rows run along
+// the contiguous dimension.
+struct __stencil_geometry {
+  size_t radius;
+  size_t n_slow, n_mid, n_fast;
+  size_t stride_slow, stride_mid;
+
+  constexpr bool empty() const noexcept {
+    return n_slow < 2 * radius + 1 || n_mid < 2 * radius + 1 ||
+           n_fast < 2 * radius + 1;
+  }
+
+  // Whether the planes a plain sweep in memory order keeps in flight already
+  // fit in cache, in which case tiles and fused time steps only add overhead.
+  constexpr bool fits(size_t element_size) const noexcept {
+    return (2 * radius + 2) * n_mid * n_fast * element_size <=
+           __stencil_cache_bytes;
+  }
+
+  // Width of the middle dimension tiles such that the planes touched by
+  // `steps` fused time steps stay in cache.
+  constexpr size_t tile(size_t steps, size_t element_size) const noexcept {
+    const size_t bytes = steps * (2 * radius + 2) * n_fast * element_size;
+    return (std::max)(size_t(1), __stencil_cache_bytes / bytes);
+  }
+};
+
+template <bool Left, class MDSpan>
+__stencil_geometry __make_stencil_geometry(const MDSpan &s, size_t radius) {
+  const auto &map = s.mapping();
+  constexpr size_t slow = Left ? 2 : 0;
+  constexpr size_t fast = Left ? 0 : 2;
+  return {radius,
+          static_cast<size_t>(map.extents().extent(slow)),
+          static_cast<size_t>(map.extents().extent(1)),
+          static_cast<size_t>(map.extents().extent(fast)),
+          static_cast<size_t>(map.stride(slow)),
+          static_cast<size_t>(map.stride(1))};
+}
+
+// Applies f to the interior rows of plane `plane` in the middle dimension
+// range [m0, m1).
+template <bool Left, class S, class D, class F>
+void __stencil_rows(S *s, D *d, const __stencil_geometry &g, size_t plane,
+                    size_t m0, size_t m1, F &f) {
+  const ptrdiff_t stride_mid = static_cast<ptrdiff_t>(g.stride_mid);
+  const ptrdiff_t stride_slow = static_cast<ptrdiff_t>(g.stride_slow);
+  const size_t end = g.n_fast - g.radius;
+  for (size_t m = m0; m < m1; ++m) {
+    const size_t row = plane * g.stride_slow + m * g.stride_mid;
+    S *sr = s + row;
+    D *dr = d + row;
+    for (size_t i = g.radius; i < end; ++i)
+      dr[i] = f(__stencil_neighborhood_strided<Left, S>{
+          sr, static_cast<ptrdiff_t>(i), stride_mid, stride_slow});
+  }
+}
+
+// One time step over the middle dimension tiles [t0, t1) of width `tile`,
+// each streamed plane by plane.
+template <bool Left, class S, class D, class F>
+void __stencil_sweep(S *s, D *d, const __stencil_geometry &g, size_t tile,
+                     size_t t0, size_t t1, F &f) {
+  const size_t m_end = g.n_mid - g.radius;
+  for (size_t t = t0; t < t1; ++t) {
+    const size_t m0 = g.radius + t * tile;
+    const size_t m1 = (std::min)(m0 + tile, m_end);
+    for (size_t plane = g.radius; plane < g.n_slow - g.radius; ++plane)
+      __stencil_rows<Left>(s, d, g, plane, m0, m1, f);
+  }
+}
+
+// `steps` time steps ping-ponging between a and b, starting from a, fused
+// into one pass over the grid. Within a tile, step t trails step t - 1 by
+// `radius` planes, so it only reads planes that step t - 1 has finished and
+// only overwrites planes that step t - 1 no longer reads. Across tiles, the
+// range of step t is shifted back by t * radius in the middle dimension, so
+// it only depends on the current and the already finished tiles and leaves
+// the values that the next tile still reads in place.
+template <bool Left, class T, class F>
+void __stencil_wavefront(T *a, T *b, const __stencil_geometry &g, size_t tile,
+                         size_t steps, F &f) {
+  const ptrdiff_t r = static_cast<ptrdiff_t>(g.radius);
+  const ptrdiff_t lo = r;
+  const ptrdiff_t m_end = static_cast<ptrdiff_t>(g.n_mid) - r;
+  const ptrdiff_t s_end = static_cast<ptrdiff_t>(g.n_slow) - r;
+  const ptrdiff_t w = static_cast<ptrdiff_t>(tile);
+  const ptrdiff_t ntiles = (m_end - lo + w - 1) / w;
+  const ptrdiff_t nsteps = static_cast<ptrdiff_t>(steps);
+  for (ptrdiff_t tb = 0; tb < ntiles; ++tb) {
+    for (ptrdiff_t front = lo; front < s_end + (nsteps - 1) * r; ++front) {
+      for (ptrdiff_t t = 0; t < nsteps; ++t) {
+        const ptrdiff_t plane = front - t * r;
+        if (plane < lo)
+          break;
+        if (plane >= s_end)
+          continue;
+        const ptrdiff_t m0 =
+            tb == 0 ? lo : (std::max)(lo, lo + tb * w - t * r);
+        const ptrdiff_t m1 =
+            tb + 1 == ntiles ? m_end : (std::max)(lo, lo + (tb + 1) * w - t * r);
+        if (m0 >= m1)
+          continue;
+        if (t % 2 == 0)
+          __stencil_rows<Left>(a, b, g, size_t(plane), size_t(m0), size_t(m1), f);
+        else
+          __stencil_rows<Left>(b, a, g, size_t(plane), size_t(m0), size_t(m1), f);
+      }
+    }
+  }
+}
+
+template <class Src, class Dst>
+constexpr bool __stencil_fast_path_v =
+    __has_pointer_access_v<Src> && __has_pointer_access_v<Dst> &&
+    __is_left_or_right_v<typename Src::layout_type> &&
+    std::is_same<typename Src::layout_type, typename Dst::layout_type>::value;
+
+//******************************************
+// Drivers
+//******************************************
+
+template <class Src, class Dst, class F>
+void __stencil_generic(const Src &src, const Dst &dst, size_t radius, F &f) {
+  using index_type = typename Dst::index_type;
+  const index_type r = static_cast<index_type>(radius);
+  // Compared without subtracting, which would wrap around for unsigned
+  // index types and extents smaller than the radius.
+  for (index_type i = r; i + r < dst.extent(0); ++i)
+    for (index_type j = r; j + r < dst.extent(1); ++j)
+      for (index_type k = r; k + r < dst.extent(2); ++k)
+        dst.accessor().access(dst.data_handle(), dst.mapping()(i, j, k)) =
+            f(__stencil_neighborhood_generic<Src>{src, i, j, k});
+}
+
+template <class Policy, class Src, class Dst, class F>
+void __stencil(const Policy &policy, const Src &src, const Dst &dst,
+               size_t radius, F f) {
+  if constexpr (__stencil_fast_path_v<Src, Dst>) {
+    constexpr bool left =
+        std::is_same<typename Src::layout_type, layout_left>::value;
+    const __stencil_geometry g = __make_stencil_geometry<left>(src, radius);
+    if (g.empty())
+      return;
+    using element_type = typename Src::element_type;
+    const size_t interior = g.n_mid - 2 * radius;
+    size_t tile = g.fits(sizeof(element_type))
+                      ? interior
+                      : (std::min)(g.tile(1, sizeof(element_type)), interior);
+    auto s = static_cast<std::add_const_t<element_type> *>(src.data_handle());
+    auto d = static_cast<typename Dst::element_type *>(dst.data_handle());
+    if constexpr (std::is_same<Policy, execution::openmp_policy>::value) {
+      // Tiles are independent within a time step; make sure every thread
+      // gets at least one.
+      const int max_threads = __openmp_max_threads(policy);
+      tile = (std::min)(tile, (interior + max_threads - 1) / max_threads);
+      const size_t ntiles = (interior + tile - 1) / tile;
+#if defined(_OPENMP)
+#pragma omp parallel num_threads(max_threads)
+#endif
+      {
+        const size_t t = static_cast<size_t>(__openmp_thread_num());
+        const size_t nt = static_cast<size_t>(__openmp_num_threads());
+        __stencil_sweep<left>(s, d, g, tile, ntiles * t / nt,
+                              ntiles * (t + 1) / nt, f);
+      }
+    } else {
+      (void)policy;
+      __stencil_sweep<left>(s, d, g, tile, 0, (interior + tile - 1) / tile, f);
+    }
+  } else {
+    (void)policy;
+    __stencil_generic(src, dst, radius, f);
+  }
+}
+
+} // namespace detail
+
+// Applies the stencil f to every interior point of src, i.e. every point at
+// least radius away from the boundary: dst(i, j, k) = f(n), where
+// n(di, dj, dk) is src(i + di, j + dj, k + dk) for |di|, |dj|, |dk| <= radius.
+// Points near the boundary of dst are left untouched.
+//
+// For layout_left and layout_right with pointer accessors the grid is swept
+// in memory order. When the planes the sweep keeps in flight do not fit in
+// cache, it is split into tiles along the middle dimension which are small
+// enough for the planes they touch to stay in cache while they are streamed
+// along the slowest dimension. src and dst must not overlap.
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor, class F>
+void stencil(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+             mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+             size_t radius, F f) {
+  static_assert(SrcExtents::rank() == 3 && DstExtents::rank() == 3,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::stencil requires mdspans of rank 3.");
+  assert(detail::__same_extents(src.extents(), dst.extents()));
+  detail::__stencil(execution::seq, src, dst, radius, f);
+}
+
+// Same, splitting the tiles across the threads of an OpenMP parallel region.
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor, class F>
+void stencil(execution::openmp_policy policy,
+             mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+             mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+             size_t radius, F f) {
+  static_assert(SrcExtents::rank() == 3 && DstExtents::rank() == 3,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::stencil requires mdspans of rank 3.");
+  assert(detail::__same_extents(src.extents(), dst.extents()));
+  detail::__stencil(policy, src, dst, radius, f);
+}
+
+// Box sum stencils: every interior point of dst gets the sum of the
+// (2 radius + 1)^3 points of src around it.
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor>
+void stencil(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+             mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+             size_t radius) {
+  detail::__with_box_sum(radius, [&](auto f) { stencil(src, dst, radius, f); });
+}
+
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor>
+void stencil(execution::openmp_policy policy,
+             mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+             mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+             size_t radius) {
+  detail::__with_box_sum(radius,
+                         [&](auto f) { stencil(policy, src, dst, radius, f); });
+}
+
+// Applies the stencil f `steps` times, ping-ponging between a and b starting
+// from a, and returns the mdspan holding the result: b for an odd number of
+// steps, a otherwise. Only interior points are written, so the points near
+// the boundary of b must hold the same (boundary) values as those of a.
+//
+// For layout_left and layout_right with pointer accessors each step is a
+// sweep in memory order as in stencil. When its planes do not fit in cache,
+// up to four time steps are fused into one sweep instead (temporal
+// blocking): each tile runs the steps as a wavefront along the slowest
+// dimension, skewed against the tiles before it, so that the grid passes
+// through cache once per four steps instead of once per step.
+template <class ElementType, class Extents, class Layout, class Accessor,
+          class F>
+mdspan<ElementType, Extents, Layout, Accessor>
+stencil_iterate(mdspan<ElementType, Extents, Layout, Accessor> a,
+                mdspan<ElementType, Extents, Layout, Accessor> b,
+                size_t radius, size_t steps, F f) {
+  using mdspan_type = mdspan<ElementType, Extents, Layout, Accessor>;
+  static_assert(Extents::rank() == 3,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::stencil_iterate requires mdspans of rank 3.");
+  assert(detail::__same_extents(a.extents(), b.extents()));
+  if constexpr (detail::__stencil_fast_path_v<mdspan_type, mdspan_type>) {
+    constexpr bool left = std::is_same<Layout, layout_left>::value;
+    const detail::__stencil_geometry g =
+        detail::__make_stencil_geometry<left>(a, radius);
+    if (!g.empty()) {
+      // A wavefront of a single step over a single tile is a plain sweep.
+      const bool fits = g.fits(sizeof(ElementType));
+      const size_t depth = fits ? 1 : detail::__stencil_temporal_depth;
+      const size_t tile =
+          fits ? g.n_mid - 2 * radius : g.tile(depth, sizeof(ElementType));
+      ElementType *pa = a.data_handle();
+      ElementType *pb = b.data_handle();
+      for (size_t done = 0; done < steps; done += depth) {
+        const size_t n = (std::min)(depth, steps - done);
+        if (done % 2 == 0)
+          detail::__stencil_wavefront<left>(pa, pb, g, tile, n, f);
+        else
+          detail::__stencil_wavefront<left>(pb, pa, g, tile, n, f);
+      }
+    }
+  } else {
+    for (size_t t = 0; t < steps; ++t) {
+      if (t % 2 == 0)
+        detail::__stencil_generic(a, b, radius, f);
+      else
+        detail::__stencil_generic(b, a, radius, f);
+    }
+  }
+  return steps % 2 == 1 ? b : a;
+}
+
+template <class ElementType, class Extents, class Layout, class Accessor>
+mdspan<ElementType, Extents, Layout, Accessor>
+stencil_iterate(mdspan<ElementType, Extents, Layout, Accessor> a,
+                mdspan<ElementType, Extents, Layout, Accessor> b,
+                size_t radius, size_t steps) {
+  mdspan<ElementType, Extents, Layout, Accessor> result = a;
+  detail::__with_box_sum(radius, [&](auto f) {
+    result = stencil_iterate(a, b, radius, steps, f);
+  });
+  return result;
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
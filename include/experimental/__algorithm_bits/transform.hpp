@@ -0,0 +1,226 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "for_each.hpp"
+#include "utility.hpp"
+
+#include <array>
+#include <cassert>
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+//******************************************
+// Transform kernels on raw pointers
+//******************************************
+
+// Computes d[i * ds] = op(s[i * ss[K]]...) for n elements. DPtr and SPtrs are
+// pointer types, restrict-qualified when the caller knows that the operands
+// don't overlap; they are class template parameters so that they are never
+// deduced, which would drop the qualifier.
+template <class DPtr, class... SPtrs>
+struct __transform_run {
+  template <class Op, size_t... K>
+  static void apply(std::index_sequence<K...>, Op &op, size_t n, DPtr d,
+                    size_t ds, const std::array<size_t, sizeof...(SPtrs)> &ss,
+                    SPtrs... s) {
+    if (ds == 1 && ((ss[K] == 1) && ...)) {
+      for (size_t i = 0; i < n; ++i)
+        d[i] = op(s[i]...);
+    } else {
+      for (size_t i = 0; i < n; ++i)
+        d[i * ds] = op(s[i * ss[K]]...);
+    }
+  }
+};
+
+template <bool NoAlias, class Op, class D, class... S>
+void __transform_strided_run(Op &op, size_t n, D *d, size_t ds,
+                             const std::array<size_t, sizeof...(S)> &ss,
+                             S *... s) {
+  if constexpr (NoAlias)
+    __transform_run<_MDSPAN_RESTRICT_POINTER(D),
+                    _MDSPAN_RESTRICT_POINTER(S)...>::apply(
+        std::index_sequence_for<S...>{}, op, n, d, ds, ss, s...);
+  else
+    __transform_run<D *, S *...>::apply(std::index_sequence_for<S...>{}, op,
+                                        n, d, ds, ss, s...);
+}
+
+// A permuted strided loop nest over one destination and N sources, outermost
+// level first.
+template <size_t Rank, size_t N>
+struct __transform_nest {
+  std::array<size_t, Rank> extents;
+  std::array<size_t, Rank> dst_strides;
+  std::array<std::array<size_t, N>, Rank> src_strides;
+};
+
+// Merges adjacent levels of nest along which the destination and every
+// source step through memory with one common stride, see __coalesce_levels.
+// Merged outer levels are left with extent 1.
+template <size_t Rank, size_t N, size_t... K>
+constexpr __transform_nest<Rank, N>
+__collapse_transform_nest(const __transform_nest<Rank, N> &nest,
+                          std::index_sequence<K...>) noexcept {
+  __transform_nest<Rank, N> result = nest;
+  // The strides of each source by level.
+  std::array<std::array<size_t, Rank>, N> src_strides{};
+  for (size_t l = 0; l < Rank; ++l)
+    ((src_strides[K][l] = nest.src_strides[l][K]), ...);
+  __coalesce_levels(0, result.extents, result.dst_strides, src_strides[K]...);
+  for (size_t l = 0; l < Rank; ++l)
+    ((result.src_strides[l][K] = src_strides[K][l]), ...);
+  return result;
+}
+
+template <size_t Rank, size_t N>
+constexpr __transform_nest<Rank, N>
+__collapse_transform_nest(const __transform_nest<Rank, N> &nest) noexcept {
+  return __collapse_transform_nest(nest, std::make_index_sequence<N>());
+}
+
+template <size_t Level, bool NoAlias, size_t Rank, size_t N, class Op,
+          class D, class... S, size_t... K>
+void __transform_nest_loop(std::index_sequence<K...> ks,
+                           const __transform_nest<Rank, N> &nest, Op &op,
+                           D *d, S *... s) {
+  const size_t n = nest.extents[Level];
+  const size_t ds = nest.dst_strides[Level];
+  const auto &ss = nest.src_strides[Level];
+  if constexpr (Level + 1 == Rank) {
+    __transform_strided_run<NoAlias>(op, n, d, ds, ss, s...);
+  } else {
+    for (size_t i = 0; i < n; ++i)
+      __transform_nest_loop<Level + 1, NoAlias>(ks, nest, op, d + i * ds,
+                                                (s + i * ss[K])...);
+  }
+}
+
+template <class Op, class Dst, class... Src>
+void __transform_impl(Op &op, const Dst &dst, const Src &... src) {
+  constexpr size_t rank = Dst::rank();
+  constexpr size_t nsrc = sizeof...(Src);
+  constexpr bool fast_path =
+      __has_pointer_access_v<Dst> && (__has_pointer_access_v<Src> && ...) &&
+      Dst::mapping_type::is_always_strided() &&
+      (Src::mapping_type::is_always_strided() && ...);
+
+  if constexpr (!fast_path) {
+    // Walks the destination in memory order where its mapping is strided.
+    auto f = [&](auto offset, auto... idx) {
+      dst.accessor().access(dst.data_handle(), static_cast<size_t>(offset)) =
+          op(src.accessor().access(src.data_handle(), src.mapping()(idx...))...);
+    };
+    for_each_index(dst.mapping(), f);
+  } else if constexpr (rank == 0) {
+    *dst.data_handle() = op(*src.data_handle()...);
+  } else {
+    constexpr bool no_alias = __no_alias_v<Dst, Src...>;
+    const auto dst_strides = __strides_array(dst.mapping());
+
+    // All operands laid out identically and without gaps: one flat loop.
+    if (dst.mapping().is_exhaustive() &&
+        ((src.mapping().is_exhaustive() &&
+          __strides_array(src.mapping()) == dst_strides) &&
+         ...)) {
+      const std::array<size_t, nsrc> unit{((void)src, size_t(1))...};
+      __transform_strided_run<no_alias>(op, __size(dst), dst.data_handle(), 1,
+                                        unit, src.data_handle()...);
+      return;
+    }
+
+    // Otherwise walk the destination in memory order, merging the levels
+    // along which all operands are contiguous.
+    const auto order = __stride_order(dst.mapping());
+    const auto exts = __extents_array(dst.mapping());
+    const std::array<std::array<size_t, rank>, nsrc> src_strides{
+        __strides_array(src.mapping())...};
+    __transform_nest<rank, nsrc> nest{};
+    for (size_t l = 0; l < rank; ++l) {
+      nest.extents[l] = exts[order[l]];
+      nest.dst_strides[l] = dst_strides[order[l]];
+      for (size_t k = 0; k < nsrc; ++k)
+        nest.src_strides[l][k] = src_strides[k][order[l]];
+    }
+    __transform_nest_loop<0, no_alias>(std::index_sequence_for<Src...>{},
+                                       __collapse_transform_nest(nest), op,
+                                       dst.data_handle(),
+                                       src.data_handle()...);
+  }
+}
+
+} // namespace detail
+
+// Assigns op(src(i...)) to dst(i...) for every multidimensional index i. Strided
+// layouts with pointer accessors are traversed in the memory order of dst; if
+// all operands use restrict_accessor the kernels assume that they don't
+// overlap.
+template <class SrcElementType, class SrcExtents, class SrcLayout,
+          class SrcAccessor, class DstElementType, class DstExtents,
+          class DstLayout, class DstAccessor, class UnaryOp>
+void transform(mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor> src,
+               mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+               UnaryOp op) {
+  using src_type = mdspan<SrcElementType, SrcExtents, SrcLayout, SrcAccessor>;
+  using dst_type = mdspan<DstElementType, DstExtents, DstLayout, DstAccessor>;
+  static_assert(SrcExtents::rank() == DstExtents::rank(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::transform requires operands of the same rank.");
+  static_assert(
+      std::is_assignable<
+          typename dst_type::reference,
+          std::invoke_result_t<UnaryOp &, typename src_type::reference>>::value,
+      MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+      "::transform requires the result of op to be assignable to dst.");
+  assert(detail::__same_extents(src.extents(), dst.extents()));
+  detail::__transform_impl(op, dst, src);
+}
+
+// Assigns op(a(i...), b(i...)) to dst(i...) for every multidimensional index i.
+template <class AElementType, class AExtents, class ALayout, class AAccessor,
+          class BElementType, class BExtents, class BLayout, class BAccessor,
+          class DstElementType, class DstExtents, class DstLayout,
+          class DstAccessor, class BinaryOp>
+void transform(mdspan<AElementType, AExtents, ALayout, AAccessor> a,
+               mdspan<BElementType, BExtents, BLayout, BAccessor> b,
+               mdspan<DstElementType, DstExtents, DstLayout, DstAccessor> dst,
+               BinaryOp op) {
+  using a_type = mdspan<AElementType, AExtents, ALayout, AAccessor>;
+  using b_type = mdspan<BElementType, BExtents, BLayout, BAccessor>;
+  using dst_type = mdspan<DstElementType, DstExtents, DstLayout, DstAccessor>;
+  static_assert(AExtents::rank() == DstExtents::rank() &&
+                    BExtents::rank() == DstExtents::rank(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::transform requires operands of the same rank.");
+  static_assert(
+      std::is_assignable<typename dst_type::reference,
+                         std::invoke_result_t<BinaryOp &,
+                                              typename a_type::reference,
+                                              typename b_type::reference>>::value,
+      MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+      "::transform requires the result of op to be assignable to dst.");
+  assert(detail::__same_extents(a.extents(), dst.extents()));
+  assert(detail::__same_extents(b.extents(), dst.extents()));
+  detail::__transform_impl(op, dst, a, b);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,191 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+
+#include <cstddef>
+#include <type_traits>
+
+// Blocks of 4 byte elements are transposed in registers with SSE2, or AVX
+// where the target has it. Define _MDSPAN_HAS_SIMD_TRANSPOSE to 0 to get
+// the scalar kernels only.
+#if !defined(_MDSPAN_HAS_SIMD_TRANSPOSE)
+#  if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define _MDSPAN_HAS_SIMD_TRANSPOSE 1
+#  else
+#    define _MDSPAN_HAS_SIMD_TRANSPOSE 0
+#  endif
+#endif
+
+#if _MDSPAN_HAS_SIMD_TRANSPOSE
+#  if defined(__AVX__)
+#    include <immintrin.h>
+#  else
+#    include <emmintrin.h>
+#  endif
+#endif
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#  define _MDSPAN_SIMD_TRANSPOSE_ON_TARGET 0
+#else
+#  define _MDSPAN_SIMD_TRANSPOSE_ON_TARGET _MDSPAN_HAS_SIMD_TRANSPOSE
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Edge length below which __transpose_2d stops splitting. Two leaf tiles of
+// 4 byte elements take 8 KiB, which leaves room in L1 for the next tile's
+// lines even when the rows of a tile map to few cache sets.
+constexpr size_t __transpose_leaf_size = 32;
+
+//******************************************
+// In-register block transposes
+//******************************************
+
+// __simd_transpose<Size>::apply(s, ss, d, ds) sets d[j * ds + i] to
+// s[i * ss + j] for all i, j < block, for elements of Size bytes. The kernels
+// only move bits, so they work for any trivially copyable element type of
+// that size. block is 0 if the target has no kernel for Size. There is none
+// for 8 byte elements: 2x2 SSE2 and 4x4 AVX blocks of doubles were measured
+// no faster than the scalar tiles the compiler generates for them.
+template <size_t Size>
+struct __simd_transpose {
+  static constexpr size_t block = 0;
+};
+
+#if _MDSPAN_SIMD_TRANSPOSE_ON_TARGET
+#if defined(__AVX__)
+
+template <>
+struct __simd_transpose<4> {
+  static constexpr size_t block = 8;
+
+  template <class S, class D>
+  MDSPAN_FORCE_INLINE_FUNCTION static void apply(const S *s, size_t ss, D *d,
+                                                 size_t ds) noexcept {
+    __m256 r[8], t[8], u[8];
+    for (size_t i = 0; i < 8; ++i)
+      r[i] = _mm256_loadu_ps(reinterpret_cast<const float *>(s + i * ss));
+    for (size_t i = 0; i < 8; i += 2) {
+      t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+      t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (size_t i = 0; i < 8; i += 4) {
+      u[i] = _mm256_shuffle_ps(t[i], t[i + 2], 0x44);
+      u[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], 0xee);
+      u[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0x44);
+      u[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], 0xee);
+    }
+    for (size_t j = 0; j < 4; ++j) {
+      _mm256_storeu_ps(reinterpret_cast<float *>(d + j * ds),
+                       _mm256_permute2f128_ps(u[j], u[j + 4], 0x20));
+      _mm256_storeu_ps(reinterpret_cast<float *>(d + (j + 4) * ds),
+                       _mm256_permute2f128_ps(u[j], u[j + 4], 0x31));
+    }
+  }
+};
+
+#else
+
+template <>
+struct __simd_transpose<4> {
+  static constexpr size_t block = 4;
+
+  template <class S, class D>
+  MDSPAN_FORCE_INLINE_FUNCTION static void apply(const S *s, size_t ss, D *d,
+                                                 size_t ds) noexcept {
+    const __m128i r0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+    const __m128i r1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + ss));
+    const __m128i r2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 2 * ss));
+    const __m128i r3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 3 * ss));
+    const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d), _mm_unpacklo_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + ds), _mm_unpackhi_epi64(t0, t1));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 2 * ds), _mm_unpacklo_epi64(t2, t3));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(d + 3 * ds), _mm_unpackhi_epi64(t2, t3));
+  }
+};
+
+#endif
+#endif
+
+// True if blocks of S can be transposed into D in registers.
+template <class S, class D>
+constexpr bool __has_simd_transpose_v =
+    std::is_same<std::remove_cv_t<S>, D>::value &&
+    std::is_trivially_copyable<D>::value &&
+    __simd_transpose<sizeof(D)>::block > 0;
+
+//******************************************
+// Two dimensional transpose
+//******************************************
+
+// Sets d[j * ds + i] to s[i * ss + j] for i < rows and j < cols, where both
+// tiles fit in L1. Full blocks go through __simd_transpose where available.
+// Blocks are visited along the destination's rows, so that each destination
+// cache line is completed before moving on.
+template <class S, class D>
+void __transpose_leaf(S *s, size_t ss, D *d, size_t ds, size_t rows,
+                      size_t cols) {
+  size_t j = 0;
+  if constexpr (__has_simd_transpose_v<S, D>) {
+    using kernel = __simd_transpose<sizeof(D)>;
+    constexpr size_t block = kernel::block;
+    for (; j + block <= cols; j += block) {
+      size_t i = 0;
+      for (; i + block <= rows; i += block)
+        kernel::apply(s + i * ss + j, ss, d + j * ds + i, ds);
+      for (; i < rows; ++i)
+        for (size_t k = j; k < j + block; ++k)
+          d[k * ds + i] = s[i * ss + k];
+    }
+  }
+  for (; j < cols; ++j)
+    for (size_t i = 0; i < rows; ++i)
+      d[j * ds + i] = s[i * ss + j];
+}
+
+// Cache oblivious transpose: halves the longer side, at a multiple of the leaf
+// size, until the tile fits __transpose_leaf. Each level of the recursion
+// eventually fits some level of the cache hierarchy without having to know
+// its size.
+template <class S, class D>
+void __transpose_2d(S *s, size_t ss, D *d, size_t ds, size_t rows,
+                    size_t cols) {
+  constexpr size_t leaf = __transpose_leaf_size;
+  if (rows <= leaf && cols <= leaf) {
+    __transpose_leaf(s, ss, d, ds, rows, cols);
+  } else if (rows >= cols) {
+    const size_t h = (rows / 2 + leaf - 1) / leaf * leaf;
+    __transpose_2d(s, ss, d, ds, h, cols);
+    __transpose_2d(s + h * ss, ss, d + h, ds, rows - h, cols);
+  } else {
+    const size_t h = (cols / 2 + leaf - 1) / leaf * leaf;
+    __transpose_2d(s, ss, d, ds, rows, h);
+    __transpose_2d(s + h, ss, d + h * ds, ds, rows, cols - h);
+  }
+}
+
+} // namespace detail
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,220 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/layout_left.hpp"
+#include "../__p0009_bits/layout_right.hpp"
+#include "../__p0009_bits/layout_stride.hpp"
+#include "../__p0009_bits/mdspan.hpp"
+#include "../__layout_bits/coalesce.hpp"
+#include "../__p2897_bits/aligned_accessor.hpp"
+#include "../__accessor_bits/non_temporal_accessor.hpp"
+#include "../__accessor_bits/restrict_accessor.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+//******************************************
+// Accessor classification
+//******************************************
+
+// Accessors for which access(p, i) is p[i] and offset(p, i) is p + i on a
+// plain pointer data handle. Algorithms may bypass the accessor for these and
+// run their kernels directly on the data handle.
+template <class Accessor>
+struct __is_pointer_accessor : std::false_type {};
+
+template <class ElementType>
+struct __is_pointer_accessor<default_accessor<ElementType>> : std::true_type {};
+
+template <class ElementType, size_t ByteAlignment>
+struct __is_pointer_accessor<aligned_accessor<ElementType, ByteAlignment>>
+    : std::true_type {};
+
+template <class ElementType>
+struct __is_pointer_accessor<restrict_accessor<ElementType>> : std::true_type {};
+
+// Accessors whose data handle is not aliased by any other data handle.
+template <class Accessor>
+struct __is_restrict_accessor : std::false_type {};
+
+template <class ElementType>
+struct __is_restrict_accessor<restrict_accessor<ElementType>> : std::true_type {};
+
+// std::is_pointer does not see through a restrict qualifier.
+template <class MDSpan>
+constexpr bool __has_pointer_access_v =
+    __is_pointer_accessor<typename MDSpan::accessor_type>::value &&
+    (std::is_pointer<typename MDSpan::data_handle_type>::value ||
+     __is_restrict_accessor<typename MDSpan::accessor_type>::value);
+
+// Accessors whose stores bypass the caches. Kernels may write through the
+// plain data handle with __non_temporal_store instead.
+template <class Accessor>
+struct __is_non_temporal_accessor : std::false_type {};
+
+template <class ElementType>
+struct __is_non_temporal_accessor<non_temporal_accessor<ElementType>>
+    : std::true_type {};
+
+// True if kernels over the two mdspans may assume that writes through one do
+// not change elements read through the other.
+template <class... MDSpans>
+constexpr bool __no_alias_v =
+    (__is_restrict_accessor<typename MDSpans::accessor_type>::value && ...);
+
+//******************************************
+// Layout classification
+//******************************************
+
+template <class Layout>
+constexpr bool __is_left_or_right_v =
+    std::is_same<Layout, layout_left>::value ||
+    std::is_same<Layout, layout_right>::value;
+
+//******************************************
+// Strided mapping descriptors
+//******************************************
+
+// Extents and strides of a strided mapping gathered into plain arrays so that
+// kernels can permute dimensions at runtime.
+template <class Mapping>
+constexpr std::array<size_t, Mapping::extents_type::rank()>
+__extents_array(const Mapping &map) noexcept {
+  std::array<size_t, Mapping::extents_type::rank()> result{};
+  for (size_t r = 0; r < Mapping::extents_type::rank(); ++r)
+    result[r] = static_cast<size_t>(map.extents().extent(r));
+  return result;
+}
+
+template <class Mapping>
+constexpr std::array<size_t, Mapping::extents_type::rank()>
+__strides_array(const Mapping &map) noexcept {
+  std::array<size_t, Mapping::extents_type::rank()> result{};
+  if constexpr (Mapping::extents_type::rank() > 0) {
+    for (size_t r = 0; r < Mapping::extents_type::rank(); ++r)
+      result[r] = static_cast<size_t>(map.stride(r));
+  }
+  return result;
+}
+
+// Dimensions of a strided mapping ordered by decreasing stride, i.e. the loop
+// order that walks memory front to back. Ties keep their relative order.
+template <class Mapping>
+constexpr std::array<size_t, Mapping::extents_type::rank()>
+__stride_order(const Mapping &map) noexcept {
+  constexpr size_t rank = Mapping::extents_type::rank();
+  using layout = typename Mapping::layout_type;
+  std::array<size_t, rank> order{};
+  for (size_t r = 0; r < rank; ++r)
+    order[r] = std::is_same<layout, layout_left>::value ? rank - 1 - r : r;
+  if constexpr (!__is_left_or_right_v<layout> && rank > 1) {
+    const auto strides = __strides_array(map);
+    // Insertion sort, rank is small.
+    for (size_t i = 1; i < rank; ++i)
+      for (size_t j = i; j > 0 && strides[order[j - 1]] < strides[order[j]]; --j)
+        std::swap(order[j - 1], order[j]);
+  }
+  return order;
+}
+
+// A permuted strided loop nest over a single data handle, outermost level
+// first.
+template <size_t Rank>
+struct __strided_nest {
+  std::array<size_t, Rank> extents;
+  std::array<size_t, Rank> strides;
+};
+
+template <class Mapping>
+constexpr __strided_nest<Mapping::extents_type::rank()>
+__make_strided_nest(const Mapping &map) noexcept {
+  constexpr size_t rank = Mapping::extents_type::rank();
+  const auto order = __stride_order(map);
+  const auto exts = __extents_array(map);
+  const auto strides = __strides_array(map);
+  __strided_nest<rank> nest{};
+  for (size_t l = 0; l < rank; ++l) {
+    nest.extents[l] = exts[order[l]];
+    nest.strides[l] = strides[order[l]];
+  }
+  return nest;
+}
+
+// Merges adjacent levels of nest that step through memory with one common
+// stride, e.g. all levels of an exhaustive layout, into its innermost levels,
+// see __coalesce_levels. The merged outer levels are left with extent 1, so
+// the nest keeps its rank but the innermost loop gets as long as possible.
+// Levels before first are kept as they are.
+template <size_t Rank>
+constexpr __strided_nest<Rank>
+__collapse_strided_nest(const __strided_nest<Rank> &nest,
+                        size_t first = 0) noexcept {
+  __strided_nest<Rank> result = nest;
+  __coalesce_levels(first, result.extents, result.strides);
+  return result;
+}
+
+template <class MDSpan>
+constexpr size_t __size(const MDSpan &s) noexcept {
+  size_t n = 1;
+  for (size_t r = 0; r < MDSpan::rank(); ++r)
+    n *= static_cast<size_t>(s.extent(r));
+  return n;
+}
+
+template <class ExtentsA, class ExtentsB>
+constexpr bool __same_extents(const ExtentsA &a, const ExtentsB &b) noexcept {
+  if constexpr (ExtentsA::rank() != ExtentsB::rank()) {
+    return false;
+  } else {
+    for (size_t r = 0; r < ExtentsA::rank(); ++r)
+      if (static_cast<size_t>(a.extent(r)) != static_cast<size_t>(b.extent(r)))
+        return false;
+    return true;
+  }
+}
+
+//******************************************
+// Generic index space traversal
+//******************************************
+
+// Calls f(idx...) for every multidimensional index of exts, last index
+// fastest. This is the fallback used for layouts that are not strided or
+// accessors which can not be bypassed.
+template <size_t Dim, class Extents, class F, class... Indices>
+constexpr void __for_each_index_right(const Extents &exts, F &f,
+                                      Indices... idx) {
+  if constexpr (Dim == Extents::rank()) {
+    f(idx...);
+  } else {
+    using index_type = typename Extents::index_type;
+    for (index_type i = 0; i < exts.extent(Dim); ++i)
+      __for_each_index_right<Dim + 1>(exts, f, idx..., i);
+  }
+}
+
+} // namespace detail
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
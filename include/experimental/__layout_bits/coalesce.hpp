@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "../__p0009_bits/extents.hpp"
+#include "../__p0009_bits/layout_stride.hpp"
+#include "../__p0009_bits/macros.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+namespace detail {
+
+// Merges adjacent levels l and l + 1 of a loop nest, given outermost first,
+// along which each operand steps through memory with one common stride, i.e.
+// strides[l] == strides[l + 1] * exts[l + 1] for the strides of every
+// operand, and drops levels of extent 1. Only the levels [first, Rank) take
+// part. The remaining ones are moved to the back in their order, the ones
+// left over in front of them get extent 1 and stride 0. Returns the first
+// remaining level.
+template <size_t Rank, class... Strides>
+MDSPAN_INLINE_FUNCTION constexpr size_t
+__coalesce_levels(size_t first, std::array<size_t, Rank> &exts,
+                  Strides &... strides) noexcept {
+  // The levels kept so far are [w, Rank). Since w > l, they never overwrite
+  // a level that is still to be read.
+  size_t w = Rank;
+  for (size_t l = Rank; l-- > first;) {
+    if (exts[l] == 1)
+      continue;
+    if (w < Rank && ((strides[l] == strides[w] * exts[w]) && ...)) {
+      exts[w] *= exts[l];
+    } else {
+      --w;
+      exts[w] = exts[l];
+      ((strides[w] = strides[l]), ...);
+    }
+  }
+  for (size_t l = first; l < w; ++l) {
+    exts[l] = 1;
+    ((strides[l] = 0), ...);
+  }
+  return w;
+}
+
+template <class IndexType, size_t Rank, size_t... R>
+MDSPAN_INLINE_FUNCTION constexpr layout_stride::mapping<dextents<IndexType, Rank>>
+__layout_stride_mapping(const std::array<size_t, Rank> &exts,
+                        const std::array<size_t, Rank> &strides,
+                        std::index_sequence<R...>) noexcept {
+  return layout_stride::mapping<dextents<IndexType, Rank>>(
+      dextents<IndexType, Rank>(static_cast<IndexType>(exts[R])...),
+      std::array<IndexType, Rank>{static_cast<IndexType>(strides[R])...});
+}
+
+} // namespace detail
+
+//==============================================================================
+// coalesce_dimensions
+//
+// Returns a layout_stride mapping equivalent to the strided mapping map, in
+// which adjacent dimensions r and r + 1 with
+// map.stride(r) == map.stride(r + 1) * map.extents().extent(r + 1) are merged
+// into one, and dimensions of extent 1 are dropped. For example, the two
+// trailing dimensions of submdspan(x, i, full_extent, full_extent) merge for
+// an exhaustive x, and an exhaustive mapping becomes a single dimension.
+//
+// The rank is part of the type, so the result keeps the rank of map: the
+// remaining dimensions are moved to the back in their order, and the front is
+// filled with dimensions of extent 1. Walking the result last index fastest
+// visits the same offsets in the same order as walking map last index
+// fastest, with fewer loops doing work and the innermost one as long as
+// possible.
+
+template <class Mapping>
+MDSPAN_INLINE_FUNCTION constexpr layout_stride::mapping<
+    dextents<typename Mapping::index_type, Mapping::extents_type::rank()>>
+coalesce_dimensions(const Mapping &map) noexcept {
+  static_assert(Mapping::is_always_strided(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::coalesce_dimensions requires a strided mapping.");
+  using index_type = typename Mapping::index_type;
+  constexpr size_t rank = Mapping::extents_type::rank();
+  std::array<size_t, rank> exts{};
+  std::array<size_t, rank> strides{};
+  if constexpr (rank > 0) {
+    for (size_t r = 0; r < rank; ++r) {
+      exts[r] = static_cast<size_t>(map.extents().extent(r));
+      strides[r] = static_cast<size_t>(map.stride(r));
+    }
+    const size_t w = detail::__coalesce_levels(0, exts, strides);
+    // Strides must be positive; those of the filler dimensions don't matter
+    // otherwise, so they continue the outermost remaining dimension.
+    for (size_t r = 0; r < w; ++r)
+      strides[r] = w < rank && exts[w] > 0 ? strides[w] * exts[w] : 1;
+  }
+  return detail::__layout_stride_mapping<index_type>(
+      exts, strides, std::make_index_sequence<rank>());
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,209 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_banded
+//
+// LAPACK band storage of a matrix with KL subdiagonals and KU superdiagonals:
+// element (i, j) of the band lives in row KU + i - j of column j of a column
+// major array with KL + KU + 1 rows, i.e. at offset KU + i - j + j * ldab().
+// All elements outside of the band map to one extra element after the band
+// storage, which the owner keeps zero, so that reads anywhere return the
+// matrix and only the band may be written. The mapping is therefore not
+// unique; algorithms use in_band, nonzero_rows and nonzero_columns to visit
+// the structurally nonzero elements only.
+
+template <size_t KL, size_t KU>
+struct layout_banded {
+  static constexpr size_t lower_bandwidth = KL;
+  static constexpr size_t upper_bandwidth = KU;
+
+  template <class Extents>
+  class mapping;
+};
+
+template <size_t KL, size_t KU>
+template <class Extents>
+class layout_banded<KL, KU>::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_banded<KL, KU>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_banded::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(extents_type::rank() == 2,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_banded requires rank 2 extents.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr index_type __kl = static_cast<index_type>(KL);
+  static constexpr index_type __ku = static_cast<index_type>(KU);
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept : __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  // Leading dimension of the band storage.
+  MDSPAN_INLINE_FUNCTION
+  static constexpr index_type ldab() noexcept { return __kl + __ku + 1; }
+
+  // Offset of the element shared by everything outside of the band.
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type zero_offset() const noexcept {
+    return ldab() * __extents.extent(1);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    if (__extents.extent(0) == 0 || __extents.extent(1) == 0)
+      return 0;
+    return zero_offset() + 1;
+  }
+
+  // True if (i, j) is stored, i.e. may be nonzero.
+  MDSPAN_INLINE_FUNCTION
+  static constexpr bool in_band(index_type i, index_type j) noexcept {
+    return i <= j + __kl && j <= i + __ku;
+  }
+
+  // The rows [first, second) of column j inside the band.
+  MDSPAN_INLINE_FUNCTION
+  constexpr std::pair<index_type, index_type> nonzero_rows(index_type j) const noexcept {
+    const index_type m = __extents.extent(0);
+    const index_type first = j > __ku ? j - __ku : 0;
+    const index_type last = j + __kl + 1 < m ? j + __kl + 1 : m;
+    return {first, first < last ? last : first};
+  }
+
+  // The columns [first, second) of row i inside the band.
+  MDSPAN_INLINE_FUNCTION
+  constexpr std::pair<index_type, index_type> nonzero_columns(index_type i) const noexcept {
+    const index_type n = __extents.extent(1);
+    const index_type first = i > __kl ? i - __kl : 0;
+    const index_type last = i + __ku + 1 < n ? i + __ku + 1 : n;
+    return {first, first < last ? last : first};
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class I0, class I1,
+    /* requires */ (
+      std::is_convertible_v<I0, index_type> &&
+      std::is_convertible_v<I1, index_type> &&
+      std::is_nothrow_constructible_v<index_type, I0> &&
+      std::is_nothrow_constructible_v<index_type, I1>
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(I0 i0, I1 i1) const noexcept {
+    const index_type i = static_cast<index_type>(i0);
+    const index_type j = static_cast<index_type>(i1);
+    return in_band(i, j) ? __ku + i - j + j * ldab() : zero_offset();
+  }
+
+  // Unique only if nothing is outside of the band.
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept {
+    constexpr size_t m = extents_type::static_extent(0);
+    constexpr size_t n = extents_type::static_extent(1);
+    return m != dynamic_extent && n != dynamic_extent &&
+           (m == 0 || n == 0 || (m <= KL + 1 && n <= KU + 1));
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept { return false; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return false; }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept {
+    const index_type m = __extents.extent(0);
+    const index_type n = __extents.extent(1);
+    return m == 0 || n == 0 || (m <= __kl + 1 && n <= __ku + 1);
+  }
+  // Every band storage element is used if no column is cut off by the top
+  // or bottom of the matrix, and the zero element if anything is off band.
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    const index_type m = __extents.extent(0);
+    const index_type n = __extents.extent(1);
+    return m == 0 || n == 0 || (__ku == 0 && n + __kl <= m && !is_unique());
+  }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+    return __extents.extent(0) * __extents.extent(1) <= 1;
+  }
+
+  // Precondition: is_strided()
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type) const noexcept { return 1; }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
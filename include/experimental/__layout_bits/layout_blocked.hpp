@@ -0,0 +1,391 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+#include "../__p0009_bits/layout_right.hpp"
+#include "../__p0009_bits/layout_stride.hpp"
+#include "../__p2630_bits/submdspan_extents.hpp"
+#include "../__p2630_bits/submdspan_mapping.hpp"
+#include "../__p2642_bits/layout_padded.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_blocked
+//
+// The index space is cut into tiles of the static size TileExtents...; tiles
+// are stored one after the other in layout_right order, and the elements of a
+// tile are contiguous, again in layout_right order. Tiles at the upper edge of
+// a dimension which does not divide evenly are padded to the full tile size.
+//
+// For power of two tile extents the tile index and the index inside the tile
+// are computed with shifts and masks.
+
+template <size_t... TileExtents>
+struct layout_blocked {
+  template <class Extents>
+  class mapping;
+};
+
+namespace detail {
+
+MDSPAN_INLINE_FUNCTION
+constexpr bool __is_power_of_two(size_t n) { return n > 0 && (n & (n - 1)) == 0; }
+
+MDSPAN_INLINE_FUNCTION
+constexpr int __log2(size_t n) { return n <= 1 ? 0 : 1 + __log2(n / 2); }
+
+// What submdspan of a single tile can be expressed as, see
+// layout_blocked::mapping::submdspan_mapping.
+enum class __blocked_sub_layout { right, right_padded, stride };
+
+// Whether a slice is statically known to take consecutive indices, i.e. is
+// not a strided_slice with a stride other than integral_constant 1.
+template <class T>
+struct __is_static_one : std::false_type {};
+
+template <class T, T Value>
+struct __is_static_one<std::integral_constant<T, Value>>
+    : std::integral_constant<bool, Value == 1> {};
+
+template <class Slice>
+constexpr bool __is_unit_step_slice_v = __is_static_one<
+    decltype(stride_of(std::declval<const Slice &>()))>::value;
+
+template <class DstExtents, size_t SrcRank, size_t... TileExtents, size_t... Kept,
+          bool... UnitStep>
+constexpr __blocked_sub_layout
+__blocked_sub_layout_kind(std::index_sequence<TileExtents...>,
+                          std::index_sequence<Kept...>,
+                          std::integer_sequence<bool, UnitStep...>) {
+  constexpr size_t n = sizeof...(Kept);
+  if constexpr (n == 0) {
+    return __blocked_sub_layout::right;
+  } else {
+    constexpr size_t tiles[] = {TileExtents...};
+    constexpr size_t kept[] = {Kept...};
+    constexpr bool unit_step[] = {UnitStep...};
+    // Only the trailing dimensions of a tile are kept, each with unit step ...
+    bool trailing = kept[n - 1] == SrcRank - 1;
+    for (size_t j = 0; j < n; ++j)
+      trailing = trailing && unit_step[kept[j]] &&
+                 (j == 0 || kept[j] == kept[j - 1] + 1);
+    if (!trailing)
+      return __blocked_sub_layout::stride;
+    // ... and all but the first of them are whole tile extents.
+    bool whole_inner = true;
+    bool whole_middle = true;
+    for (size_t j = 1; j < n; ++j) {
+      const bool whole = DstExtents::static_extent(j) == tiles[kept[j]];
+      whole_inner = whole_inner && whole;
+      whole_middle = whole_middle && (whole || j == n - 1);
+    }
+    if (whole_inner)
+      return __blocked_sub_layout::right;
+    // The last one may be shorter if the layout keeps the tile's row pitch.
+    if (whole_middle)
+      return __blocked_sub_layout::right_padded;
+    return __blocked_sub_layout::stride;
+  }
+}
+
+} // namespace detail
+
+template <size_t... TileExtents>
+template <class Extents>
+class layout_blocked<TileExtents...>::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_blocked<TileExtents...>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blocked::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(sizeof...(TileExtents) == extents_type::rank(),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blocked needs one tile extent per rank.");
+  static_assert(((TileExtents > 0 && TileExtents != dynamic_extent) && ...),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blocked tile extents must be positive and static.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr rank_type __rank = extents_type::rank();
+  static constexpr std::array<size_t, sizeof...(TileExtents)> __tiles = {TileExtents...};
+
+  template <size_t R>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  static constexpr index_type __tile_of(index_type i) noexcept {
+    constexpr size_t t = __tiles[R];
+    if constexpr (detail::__is_power_of_two(t))
+      return i >> detail::__log2(t);
+    else
+      return i / static_cast<index_type>(t);
+  }
+
+  template <size_t R>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  static constexpr index_type __in_tile(index_type i) noexcept {
+    constexpr size_t t = __tiles[R];
+    if constexpr (detail::__is_power_of_two(t))
+      return i & static_cast<index_type>(t - 1);
+    else
+      return i % static_cast<index_type>(t);
+  }
+
+  template <size_t R>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type __num_tiles() const noexcept {
+    return __tile_of<R>(__extents.extent(R) + static_cast<index_type>(__tiles[R] - 1));
+  }
+
+  template <size_t... R>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type __offset(std::index_sequence<R...>,
+                                const std::array<index_type, __rank> &idx) const noexcept {
+    index_type tile = 0;
+    index_type local = 0;
+    ((tile = tile * __num_tiles<R>() + __tile_of<R>(idx[R]),
+      local = local * static_cast<index_type>(__tiles[R]) + __in_tile<R>(idx[R])),
+     ...);
+    return tile * tile_size() + local;
+  }
+
+  template <size_t... R>
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type __total_tiles(std::index_sequence<R...>) const noexcept {
+    return (index_type(1) * ... * __num_tiles<R>());
+  }
+
+  // Stride of dimension r inside a tile.
+  MDSPAN_INLINE_FUNCTION
+  static constexpr index_type __tile_stride(rank_type r) noexcept {
+    index_type value = 1;
+    for (rank_type k = r + 1; k < __rank; ++k)
+      value *= static_cast<index_type>(__tiles[k]);
+    return value;
+  }
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept : __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  MDSPAN_INLINE_FUNCTION
+  static constexpr index_type tile_extent(rank_type r) noexcept {
+    return static_cast<index_type>(__tiles[r]);
+  }
+
+  // Number of elements in one tile, including padding.
+  MDSPAN_INLINE_FUNCTION
+  static constexpr index_type tile_size() noexcept {
+    return static_cast<index_type>((size_t(1) * ... * TileExtents));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    return __total_tiles(std::make_index_sequence<__rank>()) * tile_size();
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class... Indices,
+    /* requires */ (
+      (sizeof...(Indices) == extents_type::rank()) &&
+      (std::is_convertible_v<Indices, index_type> && ...) &&
+      (std::is_nothrow_constructible_v<index_type, Indices> && ...)
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(Indices... idxs) const noexcept {
+    return __offset(std::make_index_sequence<__rank>(),
+                    std::array<index_type, __rank>{static_cast<index_type>(idxs)...});
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+    for (rank_type r = 0; r < __rank; ++r)
+      if (extents_type::static_extent(r) == dynamic_extent ||
+          extents_type::static_extent(r) % __tiles[r] != 0)
+        return false;
+    return true;
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+    for (rank_type r = 0; r < __rank; ++r)
+      if (extents_type::static_extent(r) > __tiles[r])
+        return false;
+    return true;
+  }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    for (rank_type r = 0; r < __rank; ++r)
+      if (static_cast<size_t>(__extents.extent(r)) % __tiles[r] != 0)
+        return false;
+    return true;
+  }
+  // Strided if at most one dimension spans several tiles and all dimensions
+  // in front of it have unit tile extent, e.g. a single (partial) tile.
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+    size_t leading = 1;
+    bool spanned = false;
+    for (rank_type r = 0; r < __rank; ++r) {
+      if (static_cast<size_t>(__extents.extent(r)) > __tiles[r]) {
+        if (spanned || leading != 1)
+          return false;
+        spanned = true;
+      }
+      leading *= __tiles[r];
+    }
+    return true;
+  }
+
+  // Precondition: is_strided()
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept
+#if MDSPAN_HAS_CXX_20
+    requires ( Extents::rank() > 0 )
+#endif
+  {
+    return __tile_stride(r);
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+
+  // Slicing is supported within a single tile. The result is layout_right if
+  // the kept dimensions are the trailing ones, are taken with a unit step,
+  // and all but the first of them are statically known to cover the whole
+  // tile (e.g. a full tile taken with strided_slice and integral_constant
+  // extents), layout_right_padded if only the last one may be shorter, and
+  // layout_stride otherwise.
+  template <class... SliceSpecifiers>
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr auto submdspan_mapping(const mapping &src,
+                                          SliceSpecifiers... slices) {
+    auto dst_ext = submdspan_extents(src.extents(), slices...);
+    using dst_ext_t = decltype(dst_ext);
+    auto inv_map = detail::inv_map_rank(std::integral_constant<size_t, 0>(),
+                                        std::index_sequence<>(), slices...);
+    const auto offset = static_cast<size_t>(src(detail::first_of(slices)...));
+
+    #if !defined(_MDSPAN_HAS_CUDA) && !defined(_MDSPAN_HAS_HIP) && !defined(NDEBUG)
+    {
+      const std::array<index_type, __rank> first{
+          static_cast<index_type>(detail::first_of(slices))...};
+      const std::array<index_type, __rank> step{
+          static_cast<index_type>(detail::stride_of(slices))...};
+      const std::array<bool, __rank> kept{
+          !std::is_convertible_v<SliceSpecifiers, index_type>...};
+      std::array<index_type, __rank> last = first;
+      bool empty = false;
+      for (rank_type r = 0, k = 0; r < __rank; ++r) {
+        if (!kept[r])
+          continue;
+        const index_type e = static_cast<index_type>(dst_ext.extent(k++));
+        empty = empty || e == 0;
+        last[r] = first[r] + (e > 0 ? (e - 1) * step[r] : 0);
+      }
+      for (rank_type r = 0; r < __rank && !empty; ++r) {
+        const auto t = static_cast<index_type>(__tiles[r]);
+        if (first[r] / t != last[r] / t)
+          throw std::runtime_error("layout_blocked: submdspan must stay within one tile.");
+      }
+    }
+    #endif
+
+    constexpr auto kind = detail::__blocked_sub_layout_kind<dst_ext_t, __rank>(
+        std::index_sequence<TileExtents...>(), inv_map,
+        std::integer_sequence<
+            bool, detail::__is_unit_step_slice_v<SliceSpecifiers>...>());
+    if constexpr (kind == detail::__blocked_sub_layout::right) {
+      using dst_mapping_t = layout_right::mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{dst_mapping_t(dst_ext), offset};
+    } else if constexpr (kind == detail::__blocked_sub_layout::right_padded) {
+      using dst_mapping_t = typename layout_right_padded<
+          __tiles[__rank - 1]>::template mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{dst_mapping_t(dst_ext), offset};
+    } else {
+      using dst_mapping_t = layout_stride::mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{
+          dst_mapping_t(dst_ext, __sub_strides(inv_map, slices...)), offset};
+    }
+  }
+
+private:
+  template <size_t... Kept, class... SliceSpecifiers>
+  MDSPAN_INLINE_FUNCTION
+  static constexpr std::array<index_type, sizeof...(Kept)>
+  __sub_strides(std::index_sequence<Kept...>, SliceSpecifiers... slices) {
+    const std::array<index_type, __rank> step{
+        static_cast<index_type>(detail::stride_of(slices))...};
+    return {(__tile_stride(Kept) * step[Kept])...};
+  }
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
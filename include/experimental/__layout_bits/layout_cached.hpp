@@ -0,0 +1,219 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+#include "../__p0009_bits/layout_left.hpp"
+#include "../__p0009_bits/layout_right.hpp"
+#include "../__p0009_bits/layout_stride.hpp"
+#include "../__p2630_bits/submdspan_mapping.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_cached
+//
+// Same element order as Layout (layout_left or layout_right), but the mapping
+// stores the strides computed at construction instead of recomputing them
+// from the extents on every stride(r) and operator() call. This trades
+// rank() additional index_type members for the multiplications by dynamic
+// extents. Strides that only depend on static extents, e.g. the unit stride,
+// are still used as constants.
+
+template <class Layout>
+struct layout_cached {
+  template <class Extents>
+  class mapping;
+};
+
+template <class Layout>
+template <class Extents>
+class layout_cached<Layout>::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_cached<Layout>;
+  using base_mapping_type = typename Layout::template mapping<extents_type>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_cached::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(std::is_same_v<Layout, layout_left> || std::is_same_v<Layout, layout_right>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_cached requires layout_left or layout_right.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr rank_type __rank = extents_type::rank();
+
+  // Stride of dimension r if it only depends on static extents, else 0.
+  MDSPAN_INLINE_FUNCTION
+  static constexpr index_type __static_stride(rank_type r) noexcept {
+    const rank_type first = std::is_same_v<Layout, layout_right> ? r + 1 : 0;
+    const rank_type last = std::is_same_v<Layout, layout_right> ? __rank : r;
+    index_type value = 1;
+    for (rank_type k = first; k < last; ++k) {
+      if (extents_type::static_extent(k) == dynamic_extent)
+        return 0;
+      value *= static_cast<index_type>(extents_type::static_extent(k));
+    }
+    return value;
+  }
+
+  template <size_t R>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type __stride() const noexcept {
+    if constexpr (__static_stride(R) != 0)
+      return __static_stride(R);
+    else
+      return __strides[R];
+  }
+
+  template <size_t... R, class... Indices>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type __offset(std::index_sequence<R...>, Indices... idxs) const noexcept {
+    return (index_type(0) + ... + (idxs * __stride<R>()));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  static constexpr std::array<index_type, __rank> __strides_of(const base_mapping_type &m) noexcept {
+    std::array<index_type, __rank> strides{};
+    if constexpr (__rank > 0)
+      for (rank_type r = 0; r < __rank; ++r)
+        strides[r] = m.stride(r);
+    return strides;
+  }
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+  std::array<index_type, __rank> __strides = __strides_of(base_mapping_type());
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept
+      : mapping(base_mapping_type(exts)) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const base_mapping_type &base) noexcept
+      : __extents(base.extents()), __strides(__strides_of(base)) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()) {
+    for (rank_type r = 0; r < __rank; ++r)
+      __strides[r] = static_cast<index_type>(other.__strides[r]);
+  }
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr base_mapping_type base_mapping() const noexcept {
+    return base_mapping_type(__extents);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr operator base_mapping_type() const noexcept { return base_mapping(); }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    return base_mapping().required_span_size();
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class... Indices,
+    /* requires */ (
+      (sizeof...(Indices) == extents_type::rank()) &&
+      (std::is_convertible_v<Indices, index_type> && ...) &&
+      (std::is_nothrow_constructible_v<index_type, Indices> && ...)
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(Indices... idxs) const noexcept {
+    return __offset(std::make_index_sequence<__rank>(), static_cast<index_type>(idxs)...);
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept
+#if MDSPAN_HAS_CXX_20
+    requires ( Extents::rank() > 0 )
+#endif
+  {
+    return __strides[r];
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+
+  // Slicing goes through Layout, so submdspans have the layouts that
+  // submdspans of Layout have and no cached strides.
+  template <class... SliceSpecifiers>
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr auto submdspan_mapping(const mapping &src,
+                                          SliceSpecifiers... slices) {
+    return submdspan_mapping(src.base_mapping(), slices...);
+  }
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
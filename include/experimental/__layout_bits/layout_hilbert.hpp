@@ -0,0 +1,322 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_hilbert
+//
+// Rank 2 Hilbert curve: consecutive offsets are always neighbors along one of
+// the two dimensions, so a traversal in storage order stays local in both
+// without the jumps of the Z-order curve. The curve starts at (0, 0) with a
+// step along the last dimension. Extents are padded to a common power of two
+// n, so required_span_size() is n * n.
+//
+// operator() computes the curve index four levels at a time from a table of
+// 1024 entries; hilbert_for_each walks the curve in storage order without computing
+// it per element.
+
+struct layout_hilbert {
+  template <class Extents>
+  class mapping;
+};
+
+namespace detail {
+
+// The orientation of a sub-square of the curve relative to the whole: the
+// index bits are swapped if __swap is 1 and complemented if __invert is 1.
+// Both transformations commute, so orientations compose with xor.
+struct __hilbert_orientation {
+  uint64_t __swap;
+  uint64_t __invert;
+};
+
+// Curve digit of quadrant (x, y) in orientation o, and the orientation of
+// that quadrant.
+MDSPAN_FORCE_INLINE_FUNCTION
+constexpr uint64_t __hilbert_step(uint64_t x, uint64_t y,
+                                  __hilbert_orientation &o) noexcept {
+  const uint64_t t = (x ^ y) & o.__swap;
+  x ^= t ^ o.__invert;
+  y ^= t ^ o.__invert;
+  const uint64_t turn = y ^ 1u;
+  o.__invert ^= turn & x;
+  o.__swap ^= turn;
+  return (3u * x) ^ y;
+}
+
+// Quadrant of digit k in orientation o, the inverse of __hilbert_step.
+MDSPAN_FORCE_INLINE_FUNCTION
+constexpr void __hilbert_quadrant(uint64_t k, __hilbert_orientation &o,
+                                  uint64_t &x, uint64_t &y) noexcept {
+  uint64_t cx = k >> 1;
+  uint64_t cy = (k ^ (k >> 1)) & 1u;
+  const uint64_t turn = cy ^ 1u;
+  x = cx ^ o.__invert;
+  y = cy ^ o.__invert;
+  const uint64_t t = (x ^ y) & o.__swap;
+  x ^= t;
+  y ^= t;
+  o.__invert ^= turn & cx;
+  o.__swap ^= turn;
+}
+
+// Orientation of the whole curve. The classic curve first steps along the
+// first dimension for an even number of levels; transpose it in that case.
+MDSPAN_INLINE_FUNCTION
+constexpr __hilbert_orientation __hilbert_start(unsigned levels) noexcept {
+  return {uint64_t((levels & 1u) ^ 1u), 0};
+}
+
+// Four levels of the curve at once: entry (o.__swap | o.__invert << 1) * 256 +
+// (x << 4 | y) for four bits each of x and y holds the eight curve bits
+// shifted left by two, or'ed with the orientation afterwards.
+constexpr std::array<uint16_t, 1024> __make_hilbert_table() noexcept {
+  std::array<uint16_t, 1024> table{};
+  for (uint64_t state = 0; state < 4; ++state) {
+    for (uint64_t xy = 0; xy < 256; ++xy) {
+      __hilbert_orientation o{state & 1u, state >> 1};
+      uint64_t d = 0;
+      for (unsigned b = 4; b-- > 0;)
+        d = (d << 2) | __hilbert_step((xy >> (4 + b)) & 1u, (xy >> b) & 1u, o);
+      table[state * 256 + xy] =
+          static_cast<uint16_t>((d << 2) | o.__swap | (o.__invert << 1));
+    }
+  }
+  return table;
+}
+
+struct __hilbert_table {
+  static constexpr std::array<uint16_t, 1024> entries = __make_hilbert_table();
+};
+
+MDSPAN_INLINE_FUNCTION
+constexpr unsigned __ceil_log2(size_t n) noexcept {
+  unsigned bits = 0;
+  while ((size_t(1) << bits) < n)
+    ++bits;
+  return bits;
+}
+
+} // namespace detail
+
+template <class Extents>
+class layout_hilbert::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_hilbert;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_hilbert::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(extents_type::rank() == 2,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_hilbert requires rank 2 extents.");
+
+  template <class>
+  friend class mapping;
+
+  MDSPAN_INLINE_FUNCTION
+  static constexpr unsigned __levels_of(const extents_type &exts) noexcept {
+    const size_t e0 = static_cast<size_t>(exts.extent(0));
+    const size_t e1 = static_cast<size_t>(exts.extent(1));
+    return detail::__ceil_log2(e0 < e1 ? e1 : e0);
+  }
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+  unsigned __levels = 0;
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping() noexcept : __extents(), __levels(__levels_of(__extents)) {}
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept
+      : __extents(exts), __levels(__levels_of(exts)) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()), __levels(other.__levels) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  // The power of two both extents are padded to.
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type padded_extent() const noexcept {
+    return index_type(1) << __levels;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    if (__extents.extent(0) == 0 || __extents.extent(1) == 0)
+      return 0;
+    return padded_extent() * padded_extent();
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class I0, class I1,
+    /* requires */ (
+      std::is_convertible_v<I0, index_type> &&
+      std::is_convertible_v<I1, index_type> &&
+      std::is_nothrow_constructible_v<index_type, I0> &&
+      std::is_nothrow_constructible_v<index_type, I1>
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(I0 i0, I1 i1) const noexcept {
+    const auto x = static_cast<uint64_t>(static_cast<index_type>(i0));
+    const auto y = static_cast<uint64_t>(static_cast<index_type>(i1));
+    // Round the levels up to a multiple of four. Zero index bits on top
+    // contribute zero curve bits while the orientation is not inverted, and
+    // only toggle its swap, which the start orientation compensates.
+    const unsigned levels = (__levels + 3) & ~3u;
+    uint64_t state = detail::__hilbert_start(__levels).__swap ^ ((levels - __levels) & 1u);
+    uint64_t d = 0;
+    for (unsigned b = levels; b > 0;) {
+      b -= 4;
+      const uint16_t e = detail::__hilbert_table::entries[
+          state * 256 + (((x >> b) & 15u) << 4 | ((y >> b) & 15u))];
+      d = (d << 8) | (e >> 2);
+      state = e & 3u;
+    }
+    return static_cast<index_type>(d);
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+    constexpr size_t n = extents_type::static_extent(0);
+    return n != dynamic_extent && n == extents_type::static_extent(1) &&
+           (n & (n - 1)) == 0;
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+    constexpr size_t e0 = extents_type::static_extent(0);
+    constexpr size_t e1 = extents_type::static_extent(1);
+    return (e0 <= 1 && e1 <= 2) || (e0 <= 2 && e1 <= 1);
+  }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    return __extents.extent(0) * __extents.extent(1) == required_span_size();
+  }
+  // Strided only while a single step of the curve is taken.
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+    const auto e0 = __extents.extent(0);
+    const auto e1 = __extents.extent(1);
+    return (e0 <= 1 && e1 <= 2) || (e0 <= 2 && e1 <= 1);
+  }
+
+  // Precondition: is_strided()
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept {
+    return r == 0 ? 3 : 1;
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+};
+
+namespace detail {
+
+// Visits the sub-square of 2^level elements per side at (x0, y0) whose curve
+// indices start at d0. Sub-squares outside of the extents are skipped.
+template <class IndexType, class F>
+void __hilbert_walk(unsigned level, uint64_t x0, uint64_t y0, uint64_t d0,
+                    __hilbert_orientation o, uint64_t e0, uint64_t e1, F &f) {
+  if (x0 >= e0 || y0 >= e1)
+    return;
+  if (level == 0) {
+    f(static_cast<IndexType>(d0), static_cast<IndexType>(x0),
+      static_cast<IndexType>(y0));
+    return;
+  }
+  const uint64_t half = uint64_t(1) << (level - 1);
+  for (uint64_t k = 0; k < 4; ++k) {
+    __hilbert_orientation sub = o;
+    uint64_t x, y;
+    __hilbert_quadrant(k, sub, x, y);
+    if (level == 1) {
+      if (x0 + x < e0 && y0 + y < e1)
+        f(static_cast<IndexType>(d0 + k), static_cast<IndexType>(x0 + x),
+          static_cast<IndexType>(y0 + y));
+    } else {
+      __hilbert_walk<IndexType>(level - 1, x0 + x * half, y0 + y * half,
+                                d0 + k * half * half, sub, e0, e1, f);
+    }
+  }
+}
+
+} // namespace detail
+
+// Calls f(offset, i, j) for every index (i, j) of map's extents, in order of
+// increasing offset == map(i, j). Padding is skipped a whole sub-square at a
+// time, so the cost is proportional to the number of elements.
+template <class Extents, class F>
+void hilbert_for_each(const layout_hilbert::mapping<Extents> &map, F &&f) {
+  using index_type = typename Extents::index_type;
+  const auto levels = detail::__ceil_log2(static_cast<size_t>(map.padded_extent()));
+  detail::__hilbert_walk<index_type>(
+      levels, 0, 0, 0, detail::__hilbert_start(levels),
+      static_cast<uint64_t>(map.extents().extent(0)),
+      static_cast<uint64_t>(map.extents().extent(1)), f);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
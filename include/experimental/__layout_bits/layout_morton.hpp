@@ -0,0 +1,298 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+
+// Bit interleaving uses the BMI2 parallel bit deposit instruction where the
+// target has it. Define _MDSPAN_HAS_PDEP to 0 on CPUs where PDEP is
+// microcoded (AMD before Zen 3) to get the table based fallback.
+#if !defined(_MDSPAN_HAS_PDEP)
+#  if defined(__BMI2__)
+#    define _MDSPAN_HAS_PDEP 1
+#  else
+#    define _MDSPAN_HAS_PDEP 0
+#  endif
+#endif
+
+#if _MDSPAN_HAS_PDEP
+#  include <immintrin.h>
+#endif
+
+#if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
+#  define _MDSPAN_PDEP_ON_TARGET 0
+#else
+#  define _MDSPAN_PDEP_ON_TARGET _MDSPAN_HAS_PDEP
+#endif
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_morton
+//
+// Z-order curve: the offset of (i_0, ..., i_{R-1}) interleaves the bits of
+// the indices, bit b of i_r becoming bit b * R + (R - 1 - r) of the offset, so
+// that the last index varies fastest on the finest level. Every aligned block
+// of 2^k elements along each dimension is contiguous, which gives locality for
+// neighbors along all dimensions at once.
+//
+// All extents are padded to a common power of two n, so required_span_size()
+// is n^R; the layout is exhaustive only for equal power of two extents. Ranks
+// 2 and 3 are supported, rank 0 and 1 degenerate to layout_right.
+
+struct layout_morton {
+  template <class Extents>
+  class mapping;
+};
+
+namespace detail {
+
+MDSPAN_INLINE_FUNCTION
+constexpr size_t __bit_ceil(size_t n) noexcept {
+  size_t p = 1;
+  while (p < n)
+    p *= 2;
+  return p;
+}
+
+// Spreads the bits of x so that bit b moves to bit b * Rank.
+template <size_t Rank>
+struct __morton_dilation {
+  static_assert(Rank == 2 || Rank == 3, "");
+
+  // Index bits supported for this rank.
+  static constexpr size_t max_bits = 64 / Rank;
+
+  static constexpr uint64_t mask =
+      Rank == 2 ? 0x5555555555555555u : 0x9249249249249249u;
+
+  // Dilation of every byte value, for the fallback.
+  static constexpr std::array<uint64_t, 256> __make_table() noexcept {
+    std::array<uint64_t, 256> table{};
+    for (size_t v = 0; v < 256; ++v)
+      for (size_t b = 0; b < 8; ++b)
+        table[v] |= uint64_t((v >> b) & 1u) << (b * Rank);
+    return table;
+  }
+  static constexpr std::array<uint64_t, 256> table = __make_table();
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  static constexpr uint64_t apply(uint64_t x) noexcept {
+#if _MDSPAN_PDEP_ON_TARGET
+    return _pdep_u64(x, mask);
+#else
+    uint64_t result = 0;
+    for (size_t byte = 0; byte * 8 < max_bits; ++byte)
+      result |= table[(x >> (byte * 8)) & 0xffu] << (byte * 8 * Rank);
+    return result;
+#endif
+  }
+};
+
+} // namespace detail
+
+template <class Extents>
+class layout_morton::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_morton;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_morton::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(extents_type::rank() <= 3,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_morton supports ranks up to 3.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr rank_type __rank = extents_type::rank();
+
+  template <size_t... R, class... Indices>
+  MDSPAN_FORCE_INLINE_FUNCTION
+  static constexpr index_type __interleave(std::index_sequence<R...>,
+                                           Indices... idxs) noexcept {
+    using dilation = detail::__morton_dilation<__rank>;
+    return static_cast<index_type>(
+        ((dilation::apply(static_cast<uint64_t>(idxs)) << (__rank - 1 - R)) | ...));
+  }
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept : __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  // The common power of two all extents are padded to.
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type padded_extent() const noexcept {
+    size_t n = 0;
+    for (rank_type r = 0; r < __rank; ++r)
+      n = n < static_cast<size_t>(__extents.extent(r))
+              ? static_cast<size_t>(__extents.extent(r)) : n;
+    return static_cast<index_type>(detail::__bit_ceil(n));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    if constexpr (__rank <= 1) {
+      index_type value = 1;
+      for (rank_type r = 0; r != __rank; ++r)
+        value *= __extents.extent(r);
+      return value;
+    } else {
+      for (rank_type r = 0; r < __rank; ++r)
+        if (__extents.extent(r) == 0)
+          return 0;
+      index_type size = 1;
+      for (rank_type r = 0; r < __rank; ++r)
+        size *= padded_extent();
+      return size;
+    }
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class... Indices,
+    /* requires */ (
+      (sizeof...(Indices) == extents_type::rank()) &&
+      (std::is_convertible_v<Indices, index_type> && ...) &&
+      (std::is_nothrow_constructible_v<index_type, Indices> && ...)
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(Indices... idxs) const noexcept {
+    if constexpr (__rank <= 1)
+      return (index_type(0) + ... + static_cast<index_type>(idxs));
+    else
+      return __interleave(std::make_index_sequence<__rank>(),
+                          static_cast<index_type>(idxs)...);
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      const size_t n = extents_type::static_extent(0);
+      if (n == dynamic_extent || detail::__bit_ceil(n) != n)
+        return false;
+      for (rank_type r = 1; r < __rank; ++r)
+        if (extents_type::static_extent(r) != n)
+          return false;
+      return true;
+    }
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      for (rank_type r = 0; r < __rank; ++r)
+        if (extents_type::static_extent(r) > 2)
+          return false;
+      return true;
+    }
+  }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      size_t size = 1;
+      for (rank_type r = 0; r < __rank; ++r)
+        size *= static_cast<size_t>(__extents.extent(r));
+      return size == static_cast<size_t>(required_span_size());
+    }
+  }
+  // Strided while no index has more than one bit.
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      for (rank_type r = 0; r < __rank; ++r)
+        if (__extents.extent(r) > 2)
+          return false;
+      return true;
+    }
+  }
+
+  // Precondition: is_strided()
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept
+#if MDSPAN_HAS_CXX_20
+    requires ( Extents::rank() > 0 )
+#endif
+  {
+    return index_type(1) << (__rank - 1 - r);
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -39,27 +39,66 @@ class layout_left::mapping {
     template <class>
     friend class mapping;
 
-    // i0+(i1 + E(1)*(i2 + E(2)*i3))
+    // The strides of the indices before __static_strides_end() only involve
+    // static extents, so __static_stride folds them into constants. For fully
+    // static extents this is every index.
+    MDSPAN_INLINE_FUNCTION
+    static constexpr rank_type __static_strides_end() noexcept {
+      rank_type r = 0;
+      while(r + 1 < extents_type::rank() && extents_type::static_extent(r) != dynamic_extent) r++;
+      return extents_type::rank() == 0 ? 0 : r + 1;
+    }
+
+    MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __static_stride(rank_type i) noexcept {
+      index_type value = 1;
+      for(rank_type r = 0; r < i; r++)
+        value *= static_cast<index_type>(extents_type::static_extent(r));
+      return value;
+    }
+
     template <size_t r, size_t Rank>
     struct __rank_count {};
 
+    // i_r + E(r)*(i_r+1 + E(r+1)*(i_r+2 + ...))
     template <size_t r, size_t Rank, class I, class... Indices>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(
+    constexpr index_type __dynamic_offset(
       __rank_count<r,Rank>, const I& i, Indices... idx) const {
-      return __compute_offset(__rank_count<r+1,Rank>(), idx...) *
+      return __dynamic_offset(__rank_count<r+1,Rank>(), idx...) *
                  __extents.extent(r) + i;
     }
 
     template<class I>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(
+    constexpr index_type __dynamic_offset(
       __rank_count<extents_type::rank()-1,extents_type::rank()>, const I& i) const {
       return i;
     }
 
+    // i0*S(0) + i1*S(1) + ... with constant strides up to the first index
+    // with a dynamic stride, from which on the remaining indices go through
+    // __dynamic_offset
+    template <size_t r, size_t Rank, class I, class... Indices>
+    _MDSPAN_HOST_DEVICE
+    constexpr index_type __compute_offset(
+      __rank_count<r,Rank>, std::true_type, const I& i, Indices... idx) const {
+      return i * std::integral_constant<index_type, __static_stride(r)>::value +
+             __compute_offset(__rank_count<r+1,Rank>(),
+                              std::integral_constant<bool, (r+1 < __static_strides_end() || r+1 == Rank)>(), idx...);
+    }
+
+    template <size_t Rank>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(__rank_count<0,0>) const { return 0; }
+    constexpr index_type __compute_offset(__rank_count<Rank,Rank>, std::true_type) const { return 0; }
+
+    template <size_t r, size_t Rank, class... Indices>
+    _MDSPAN_HOST_DEVICE
+    constexpr index_type __compute_offset(
+      __rank_count<r,Rank>, std::false_type, Indices... idx) const {
+      return std::integral_constant<index_type, __static_stride(r-1)>::value * __extents.extent(r-1) *
+             __dynamic_offset(__rank_count<r,Rank>(), idx...);
+    }
 
   public:
 
@@ -163,7 +202,8 @@ class layout_left::mapping {
     )
     _MDSPAN_HOST_DEVICE
     constexpr index_type operator()(Indices... idxs) const noexcept {
-      return __compute_offset(__rank_count<0, extents_type::rank()>(), static_cast<index_type>(idxs)...);
+      return __compute_offset(__rank_count<0, extents_type::rank()>(), std::true_type(),
+                              static_cast<index_type>(idxs)...);
     }
 
 
@@ -40,31 +40,70 @@ class layout_right::mapping {
     template <class>
     friend class mapping;
 
-    // i0+(i1 + E(1)*(i2 + E(2)*i3))
+    // The strides of the indices from __static_strides_begin() on only involve
+    // static extents, so __static_stride folds them into constants. For fully
+    // static extents this is every index.
+    MDSPAN_INLINE_FUNCTION
+    static constexpr rank_type __static_strides_begin() noexcept {
+      rank_type r = extents_type::rank() == 0 ? 0 : extents_type::rank() - 1;
+      while(r > 0 && extents_type::static_extent(r) != dynamic_extent) r--;
+      return r;
+    }
+
+    MDSPAN_INLINE_FUNCTION
+    static constexpr index_type __static_stride(rank_type i) noexcept {
+      index_type value = 1;
+      for(rank_type r = i + 1; r < extents_type::rank(); r++)
+        value *= static_cast<index_type>(extents_type::static_extent(r));
+      return value;
+    }
+
     template <size_t r, size_t Rank>
     struct __rank_count {};
 
+    // i_r*S(r) + i_r+1*S(r+1) + ... with constant strides
+    template <size_t Rank>
+    _MDSPAN_HOST_DEVICE
+    static constexpr index_type __static_offset(__rank_count<Rank,Rank>) { return 0; }
+
     template <size_t r, size_t Rank, class I, class... Indices>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(
-      index_type offset, __rank_count<r,Rank>, const I& i, Indices... idx) const {
-      return __compute_offset(offset * __extents.extent(r) + i,__rank_count<r+1,Rank>(),  idx...);
+    static constexpr index_type __static_offset(
+      __rank_count<r,Rank>, const I& i, Indices... idx) {
+      return i * std::integral_constant<index_type, __static_stride(r)>::value +
+             __static_offset(__rank_count<r+1,Rank>(), idx...);
     }
 
-    template<class I, class ... Indices>
+    // ((i0*E(1) + i1)*E(2) + ...) up to the first index with a constant
+    // stride, from which on the remaining indices go through __static_offset
+    template <size_t r, size_t Rank, class I, class... Indices>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(
-      __rank_count<0,extents_type::rank()>, const I& i, Indices... idx) const {
-      return __compute_offset(i,__rank_count<1,extents_type::rank()>(),idx...);
+    constexpr index_type __dynamic_offset(
+      index_type offset, __rank_count<r,Rank>, std::false_type, const I& i, Indices... idx) const {
+      return __dynamic_offset(offset * __extents.extent(r) + i, __rank_count<r+1,Rank>(),
+                              std::integral_constant<bool, (r+1 >= __static_strides_begin())>(), idx...);
     }
 
+    template <size_t r, size_t Rank, class... Indices>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(size_t offset, __rank_count<extents_type::rank(), extents_type::rank()>) const {
-      return static_cast<index_type>(offset);
+    constexpr index_type __dynamic_offset(
+      index_type offset, __rank_count<r,Rank>, std::true_type, Indices... idx) const {
+      return offset * __extents.extent(r) * std::integral_constant<index_type, __static_stride(r)>::value +
+             __static_offset(__rank_count<r,Rank>(), idx...);
     }
 
+    template<class... Indices>
     _MDSPAN_HOST_DEVICE
-    constexpr index_type __compute_offset(__rank_count<0,0>) const { return 0; }
+    constexpr index_type __compute_offset(std::true_type, Indices... idx) const {
+      return __static_offset(__rank_count<0,extents_type::rank()>(), idx...);
+    }
+
+    template<class I, class... Indices>
+    _MDSPAN_HOST_DEVICE
+    constexpr index_type __compute_offset(std::false_type, const I& i, Indices... idx) const {
+      return __dynamic_offset(i, __rank_count<1,extents_type::rank()>(),
+                              std::integral_constant<bool, (1 >= __static_strides_begin())>(), idx...);
+    }
 
   public:
 
@@ -168,7 +207,8 @@ class layout_right::mapping {
     )
     _MDSPAN_HOST_DEVICE
     constexpr index_type operator()(Indices... idxs) const noexcept {
-      return __compute_offset(__rank_count<0, extents_type::rank()>(), static_cast<index_type>(idxs)...);
+      return __compute_offset(std::integral_constant<bool, __static_strides_begin() == 0>(),
+                              static_cast<index_type>(idxs)...);
     }
 
     MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+#include "../__p0009_bits/mdspan.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// conj found by argument dependent lookup, e.g. std::conj for std::complex.
+template <class T, class = void>
+struct __has_adl_conj : std::false_type {};
+
+template <class T>
+struct __has_adl_conj<T, std::void_t<decltype(conj(std::declval<T>()))>>
+    : std::true_type {};
+
+// Complex conjugate of t, or t itself for arithmetic types and types without
+// conj, which std::conj would turn into complex numbers.
+template <class T>
+MDSPAN_INLINE_FUNCTION constexpr auto __conj_if_needed(const T &t) {
+  if constexpr (!std::is_arithmetic<T>::value && __has_adl_conj<T>::value)
+    return conj(t);
+  else
+    return t;
+}
+
+} // namespace detail
+
+// Read-only accessor returning the complex conjugate of every element read
+// through NestedAccessor, as in P1673.
+template <class NestedAccessor>
+class conjugated_accessor {
+public:
+  using element_type = std::add_const_t<decltype(detail::__conj_if_needed(
+      std::declval<typename NestedAccessor::element_type>()))>;
+  using reference = std::remove_const_t<element_type>;
+  using data_handle_type = typename NestedAccessor::data_handle_type;
+  using offset_policy =
+      conjugated_accessor<typename NestedAccessor::offset_policy>;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr conjugated_accessor() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr conjugated_accessor(const NestedAccessor &acc)
+      : nested_accessor_(acc) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherNestedAccessor,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_constructible, NestedAccessor, const OtherNestedAccessor&)
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT(
+    (!std::is_convertible<OtherNestedAccessor, NestedAccessor>::value))
+  MDSPAN_INLINE_FUNCTION
+  constexpr conjugated_accessor(
+      const conjugated_accessor<OtherNestedAccessor> &other)
+      : nested_accessor_(other.nested_accessor()) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const {
+    return detail::__conj_if_needed(typename NestedAccessor::element_type(
+        nested_accessor_.access(p, i)));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type p, size_t i) const {
+    return nested_accessor_.offset(p, i);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const NestedAccessor &nested_accessor() const noexcept {
+    return nested_accessor_;
+  }
+
+private:
+  NestedAccessor nested_accessor_{};
+};
+
+// Returns a read-only view of the complex conjugate of x. Conjugating a
+// conjugated view gives back a view with the original accessor.
+template <class ElementType, class Extents, class Layout, class Accessor>
+MDSPAN_INLINE_FUNCTION constexpr auto
+conjugated(mdspan<ElementType, Extents, Layout, Accessor> x) {
+  using accessor_type = conjugated_accessor<Accessor>;
+  return mdspan<typename accessor_type::element_type, Extents, Layout,
+                accessor_type>(x.data_handle(), x.mapping(),
+                               accessor_type(x.accessor()));
+}
+
+template <class ElementType, class Extents, class Layout, class NestedAccessor>
+MDSPAN_INLINE_FUNCTION constexpr auto
+conjugated(mdspan<ElementType, Extents, Layout,
+                  conjugated_accessor<NestedAccessor>> x) {
+  return mdspan<typename NestedAccessor::element_type, Extents, Layout,
+                NestedAccessor>(x.data_handle(), x.mapping(),
+                                x.accessor().nested_accessor());
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
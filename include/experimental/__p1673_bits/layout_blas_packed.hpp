@@ -0,0 +1,210 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+#include "../__p0009_bits/macros.hpp"
+
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// Layout tags, as in P1673
+
+struct column_major_t {
+  explicit column_major_t() = default;
+};
+_MDSPAN_INLINE_VARIABLE constexpr column_major_t column_major{};
+
+struct row_major_t {
+  explicit row_major_t() = default;
+};
+_MDSPAN_INLINE_VARIABLE constexpr row_major_t row_major{};
+
+struct upper_triangle_t {
+  explicit upper_triangle_t() = default;
+};
+_MDSPAN_INLINE_VARIABLE constexpr upper_triangle_t upper_triangle{};
+
+struct lower_triangle_t {
+  explicit lower_triangle_t() = default;
+};
+_MDSPAN_INLINE_VARIABLE constexpr lower_triangle_t lower_triangle{};
+
+//==============================================================================
+// layout_blas_packed
+//
+// Packed storage of a square symmetric matrix as in P1673: only the Triangle
+// is stored, its columns (column_major_t) or rows (row_major_t) one after the
+// other, so required_span_size() is n * (n + 1) / 2. Indices outside of the
+// triangle map to their mirror image, which makes the mapping non-unique for
+// n > 1. Triangular matrices use the same layout and read only the triangle.
+
+template <class Triangle, class StorageOrder>
+struct layout_blas_packed {
+  static_assert(std::is_same<Triangle, upper_triangle_t>::value ||
+                std::is_same<Triangle, lower_triangle_t>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::layout_blas_packed: Triangle must be upper_triangle_t or lower_triangle_t.");
+  static_assert(std::is_same<StorageOrder, column_major_t>::value ||
+                std::is_same<StorageOrder, row_major_t>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::layout_blas_packed: StorageOrder must be column_major_t or row_major_t.");
+
+  using triangle_type = Triangle;
+  using storage_order_type = StorageOrder;
+
+  template <class Extents>
+  class mapping;
+};
+
+template <class Triangle, class StorageOrder>
+template <class Extents>
+class layout_blas_packed<Triangle, StorageOrder>::mapping {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_blas_packed<Triangle, StorageOrder>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blas_packed::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+  static_assert(extents_type::rank() == 2,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blas_packed requires rank 2 extents.");
+  static_assert(extents_type::static_extent(0) == dynamic_extent ||
+                extents_type::static_extent(1) == dynamic_extent ||
+                extents_type::static_extent(0) == extents_type::static_extent(1),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_blas_packed requires square extents.");
+
+  template <class>
+  friend class mapping;
+
+  // Storing the upper triangle by columns is storing the lower one by rows
+  // with the indices swapped, so two formulas cover all four variants.
+  static constexpr bool __stores_leading =
+      std::is_same<Triangle, upper_triangle_t>::value ==
+      std::is_same<StorageOrder, column_major_t>::value;
+
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping() noexcept = default;
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  // Precondition: exts.extent(0) == exts.extent(1)
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept : __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const mapping<OtherExtents> &other) noexcept
+      : __extents(other.extents()) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    const index_type n = __extents.extent(0);
+    return n * (n + 1) / 2;
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class I0, class I1,
+    /* requires */ (
+      std::is_convertible_v<I0, index_type> &&
+      std::is_convertible_v<I1, index_type> &&
+      std::is_nothrow_constructible_v<index_type, I0> &&
+      std::is_nothrow_constructible_v<index_type, I1>
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(I0 i0, I1 i1) const noexcept {
+    const index_type r = static_cast<index_type>(i0);
+    const index_type c = static_cast<index_type>(i1);
+    const index_type i = r < c ? r : c;
+    const index_type j = r < c ? c : r;
+    if constexpr (__stores_leading) {
+      // Column j of the upper triangle holds rows 0 to j.
+      return i + j * (j + 1) / 2;
+    } else {
+      // Row i of the upper triangle holds columns i to n - 1.
+      const index_type n = __extents.extent(0);
+      return (j - i) + i * (2 * n - i + 1) / 2;
+    }
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept {
+    return extents_type::static_extent(0) != dynamic_extent &&
+           extents_type::static_extent(0) < 2;
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept {
+    return is_always_unique();
+  }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept {
+    return __extents.extent(0) < 2;
+  }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept {
+    return __extents.extent(0) < 2;
+  }
+
+  // Precondition: is_strided()
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type) const noexcept { return 1; }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return lhs.extents() == rhs.extents();
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ ( OtherExtents::rank() == extents_type::rank() )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const mapping<OtherExtents> &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+};
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
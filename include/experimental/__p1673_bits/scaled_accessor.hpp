@@ -0,0 +1,102 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/macros.hpp"
+#include "../__p0009_bits/mdspan.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Read-only accessor returning scaling_factor() * x for every element x read
+// through NestedAccessor, as in P1673. Submdspans keep the scaling factor and
+// slice the nested accessor through its offset_policy.
+template <class ScalingFactor, class NestedAccessor>
+class scaled_accessor {
+public:
+  using element_type = std::add_const_t<decltype(
+      std::declval<ScalingFactor>() *
+      std::declval<typename NestedAccessor::element_type>())>;
+  using reference = std::remove_const_t<element_type>;
+  using data_handle_type = typename NestedAccessor::data_handle_type;
+  using offset_policy =
+      scaled_accessor<ScalingFactor, typename NestedAccessor::offset_policy>;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr scaled_accessor() = default;
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr scaled_accessor(const ScalingFactor &s, const NestedAccessor &a)
+      : scaling_factor_(s), nested_accessor_(a) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherScalingFactor, class OtherNestedAccessor,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_constructible, NestedAccessor, const OtherNestedAccessor&) &&
+      _MDSPAN_TRAIT(std::is_constructible, ScalingFactor, OtherScalingFactor)
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT(
+    (!std::is_convertible<OtherNestedAccessor, NestedAccessor>::value ||
+     !std::is_convertible<OtherScalingFactor, ScalingFactor>::value))
+  MDSPAN_INLINE_FUNCTION
+  constexpr scaled_accessor(
+      const scaled_accessor<OtherScalingFactor, OtherNestedAccessor> &other)
+      : scaling_factor_(other.scaling_factor()),
+        nested_accessor_(other.nested_accessor()) {}
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const {
+    return scaling_factor_ * typename NestedAccessor::element_type(
+                                 nested_accessor_.access(p, i));
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type p, size_t i) const {
+    return nested_accessor_.offset(p, i);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const ScalingFactor &scaling_factor() const noexcept {
+    return scaling_factor_;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const NestedAccessor &nested_accessor() const noexcept {
+    return nested_accessor_;
+  }
+
+private:
+  ScalingFactor scaling_factor_{};
+  NestedAccessor nested_accessor_{};
+};
+
+// Returns a read-only view of alpha * x, computed on access.
+template <class ScalingFactor, class ElementType, class Extents, class Layout,
+          class Accessor>
+MDSPAN_INLINE_FUNCTION constexpr auto
+scaled(ScalingFactor alpha, mdspan<ElementType, Extents, Layout, Accessor> x) {
+  using accessor_type = scaled_accessor<ScalingFactor, Accessor>;
+  return mdspan<typename accessor_type::element_type, Extents, Layout,
+                accessor_type>(x.data_handle(), x.mapping(),
+                               accessor_type(alpha, x.accessor()));
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -0,0 +1,98 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p2897_bits/aligned_accessor.hpp"
+#include "mdarray.hpp"
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+// Allocator whose allocations start on a ByteAlignment boundary, so that a
+// container using it can be viewed through
+// aligned_accessor<ElementType, ByteAlignment>.
+template <class ElementType, size_t ByteAlignment>
+struct aligned_allocator {
+  static_assert(detail::__is_valid_byte_alignment(ByteAlignment, alignof(ElementType)),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::aligned_allocator: ByteAlignment must be a power of two no less than alignof(ElementType).");
+
+  using value_type = ElementType;
+
+  static constexpr size_t byte_alignment = ByteAlignment;
+
+  template <class OtherElementType>
+  struct rebind {
+    using other = aligned_allocator<OtherElementType, ByteAlignment>;
+  };
+
+  constexpr aligned_allocator() noexcept = default;
+
+  template <class OtherElementType>
+  constexpr aligned_allocator(const aligned_allocator<OtherElementType, ByteAlignment> &) noexcept {}
+
+  ElementType *allocate(size_t n) {
+    return static_cast<ElementType *>(
+        ::operator new(n * sizeof(ElementType), std::align_val_t(byte_alignment)));
+  }
+
+  void deallocate(ElementType *p, size_t) noexcept {
+    ::operator delete(p, std::align_val_t(byte_alignment));
+  }
+
+  template <class OtherElementType>
+  friend constexpr bool operator==(const aligned_allocator &,
+                                   const aligned_allocator<OtherElementType, ByteAlignment> &) noexcept {
+    return true;
+  }
+
+  template <class OtherElementType>
+  friend constexpr bool operator!=(const aligned_allocator &,
+                                   const aligned_allocator<OtherElementType, ByteAlignment> &) noexcept {
+    return false;
+  }
+};
+
+// Container for mdarray with aligned storage.
+template <class ElementType, size_t ByteAlignment>
+using aligned_vector = std::vector<ElementType, aligned_allocator<ElementType, ByteAlignment>>;
+
+// mdarray whose storage is aligned to ByteAlignment bytes. Use
+// to_aligned_mdspan to get a view which exposes the alignment.
+template <class ElementType, class Extents, size_t ByteAlignment,
+          class LayoutPolicy = layout_right>
+using aligned_mdarray = mdarray<ElementType, Extents, LayoutPolicy,
+                                aligned_vector<ElementType, ByteAlignment>>;
+
+template <class ElementType, class Extents, class LayoutPolicy, size_t ByteAlignment>
+constexpr mdspan<ElementType, Extents, LayoutPolicy, aligned_accessor<ElementType, ByteAlignment>>
+to_aligned_mdspan(mdarray<ElementType, Extents, LayoutPolicy,
+                          aligned_vector<ElementType, ByteAlignment>> &a) {
+  return a.to_mdspan(aligned_accessor<ElementType, ByteAlignment>());
+}
+
+template <class ElementType, class Extents, class LayoutPolicy, size_t ByteAlignment>
+constexpr mdspan<const ElementType, Extents, LayoutPolicy, aligned_accessor<const ElementType, ByteAlignment>>
+to_aligned_mdspan(const mdarray<ElementType, Extents, LayoutPolicy,
+                                aligned_vector<ElementType, ByteAlignment>> &a) {
+  return a.to_mdspan(aligned_accessor<const ElementType, ByteAlignment>());
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
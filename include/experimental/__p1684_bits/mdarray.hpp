@@ -409,9 +409,13 @@ public:
 
   MDSPAN_INLINE_FUNCTION constexpr const extents_type& extents() const noexcept { return map_.extents(); };
   MDSPAN_INLINE_FUNCTION constexpr index_type extent(size_t r) const noexcept { return map_.extents().extent(r); };
-  MDSPAN_INLINE_FUNCTION constexpr index_type size() const noexcept {
-//    return __impl::__size(*this);
-    return ctr_.size();
+  // The container may hold more than size() elements when the mapping is
+  // not exhaustive, e.g. for padded layouts.
+  MDSPAN_INLINE_FUNCTION _MDSPAN_CONSTEXPR_14 index_type size() const noexcept {
+    index_type result = 1;
+    for (rank_type r = 0; r < rank(); ++r)
+      result *= extent(r);
+    return result;
   };
 
 
@@ -0,0 +1,376 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "mdarray.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Alignment of the blocks the resources below obtain from operator new, and
+// of every allocation they hand out unless more is asked for: a cache line,
+// which also suits any SIMD width up to 512 bits.
+constexpr size_t __resource_alignment = 64;
+
+inline void *__resource_upstream_allocate(size_t bytes) {
+  return ::operator new(bytes, std::align_val_t(__resource_alignment));
+}
+
+inline void __resource_upstream_deallocate(void *p) noexcept {
+  ::operator delete(p, std::align_val_t(__resource_alignment));
+}
+
+inline size_t __align_up(size_t n, size_t alignment) noexcept {
+  return (n + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace detail
+
+//==============================================================================
+// arena_resource
+//
+// Bump-pointer arena for short-lived temporaries, e.g. the mdarrays of one
+// time step. allocate moves a pointer through large blocks obtained from
+// operator new; deallocate only takes back the most recent allocation, and
+// reset() makes all of the arena available again at once. After a reset
+// that found more than one block in use, the blocks are replaced by a single
+// one of their total size, so that once the largest step has been seen,
+// steps no longer reach operator new at all.
+//
+// Not thread safe. Containers drawing from the arena must be destroyed
+// before reset() or the arena's destruction.
+
+class arena_resource {
+public:
+  explicit arena_resource(size_t block_bytes = size_t(1) << 20)
+      : m_block_bytes(block_bytes) {}
+
+  arena_resource(const arena_resource &) = delete;
+  arena_resource &operator=(const arena_resource &) = delete;
+
+  ~arena_resource() { release(); }
+
+  void *allocate(size_t bytes,
+                 size_t alignment = detail::__resource_alignment) {
+    if (alignment < detail::__resource_alignment)
+      alignment = detail::__resource_alignment;
+    const std::uintptr_t begin = detail::__align_up(
+        reinterpret_cast<std::uintptr_t>(m_next), alignment);
+    const std::uintptr_t end = reinterpret_cast<std::uintptr_t>(m_end);
+    if (begin <= end && bytes <= end - begin) {
+      m_last = reinterpret_cast<char *>(begin);
+      m_next = m_last + bytes;
+      return m_last;
+    }
+    return allocate_from_next_block(bytes, alignment);
+  }
+
+  void deallocate(void *p, size_t bytes, size_t = 0) noexcept {
+    if (static_cast<char *>(p) == m_last && m_last + bytes == m_next)
+      m_next = m_last;
+  }
+
+  void reset() {
+    if (m_blocks.size() > 1) {
+      const size_t total = capacity();
+      char *merged =
+          static_cast<char *>(detail::__resource_upstream_allocate(total));
+      release();
+      m_blocks.push_back(__block{merged, total});
+    }
+    m_current = 0;
+    use_block();
+  }
+
+  // Bytes obtained from operator new and not returned yet.
+  size_t capacity() const noexcept {
+    size_t total = 0;
+    for (const __block &b : m_blocks)
+      total += b.size;
+    return total;
+  }
+
+private:
+  struct __block {
+    char *data;
+    size_t size;
+  };
+
+  void release() noexcept {
+    for (const __block &b : m_blocks)
+      detail::__resource_upstream_deallocate(b.data);
+    m_blocks.clear();
+  }
+
+  // Moves the bump pointer to the start of block m_current, if there is one.
+  void use_block() noexcept {
+    if (m_current < m_blocks.size()) {
+      m_next = m_blocks[m_current].data;
+      m_end = m_next + m_blocks[m_current].size;
+    } else {
+      m_next = m_end = nullptr;
+    }
+    m_last = nullptr;
+  }
+
+  // Tries the blocks after the current one, which are left over from before
+  // a reset, then a new block.
+  void *allocate_from_next_block(size_t bytes, size_t alignment) {
+    while (m_current + 1 < m_blocks.size()) {
+      ++m_current;
+      use_block();
+      if (m_blocks[m_current].size >= bytes + alignment)
+        return allocate(bytes, alignment);
+    }
+    // Over-allocate by the alignment, so that the block fits bytes whatever
+    // the alignment of operator new's result beyond __resource_alignment.
+    const size_t size = bytes + alignment > m_block_bytes
+                            ? bytes + alignment
+                            : m_block_bytes;
+    m_blocks.reserve(m_blocks.size() + 1);
+    m_blocks.push_back(__block{
+        static_cast<char *>(detail::__resource_upstream_allocate(size)), size});
+    m_current = m_blocks.size() - 1;
+    use_block();
+    return allocate(bytes, alignment);
+  }
+
+  size_t m_block_bytes;
+  std::vector<__block> m_blocks;
+  // Block the bump pointer m_next is in, the end of that block, and the
+  // latest allocation from it.
+  size_t m_current = 0;
+  char *m_next = nullptr;
+  char *m_end = nullptr;
+  char *m_last = nullptr;
+};
+
+//==============================================================================
+// pool_resource
+//
+// Pool of free lists by size class, for temporaries that are not freed in
+// the reverse order of their allocation. Requests are rounded up to a power
+// of two of at least 64 bytes; blocks of each class are carved from slabs
+// obtained from operator new and kept on the free list of their class when
+// deallocated. Requests larger than max_pooled_bytes, or aligned to more
+// than a cache line, go to operator new directly. reset() puts every block of
+// every slab back on its free list, whether it was deallocated or not; it
+// does not reclaim requests that went to operator new.
+//
+// Not thread safe. Containers drawing from the pool must be destroyed before
+// reset() or the pool's destruction; reset() is for temporaries that are
+// abandoned rather than destroyed, e.g. storage handed out to views.
+
+class pool_resource {
+public:
+  static constexpr size_t min_block_bytes = detail::__resource_alignment;
+
+  explicit pool_resource(size_t max_pooled_bytes = size_t(1) << 22,
+                         size_t slab_bytes = size_t(1) << 20)
+      : m_slab_bytes(slab_bytes) {
+    size_t n = 0;
+    while ((min_block_bytes << n) < max_pooled_bytes)
+      ++n;
+    m_classes.resize(n + 1);
+  }
+
+  pool_resource(const pool_resource &) = delete;
+  pool_resource &operator=(const pool_resource &) = delete;
+
+  ~pool_resource() {
+    for (__size_class &c : m_classes)
+      for (void *slab : c.slabs)
+        detail::__resource_upstream_deallocate(slab);
+  }
+
+  void *allocate(size_t bytes,
+                 size_t alignment = detail::__resource_alignment) {
+    const size_t c = size_class(bytes);
+    if (c >= m_classes.size() || alignment > detail::__resource_alignment)
+      return ::operator new(bytes, std::align_val_t(
+                                       alignment > detail::__resource_alignment
+                                           ? alignment
+                                           : detail::__resource_alignment));
+    __size_class &cls = m_classes[c];
+    if (cls.free == nullptr)
+      grow(c);
+    __free_block *b = cls.free;
+    cls.free = b->next;
+    return b;
+  }
+
+  void deallocate(void *p, size_t bytes,
+                  size_t alignment = detail::__resource_alignment) noexcept {
+    const size_t c = size_class(bytes);
+    if (c >= m_classes.size() || alignment > detail::__resource_alignment) {
+      ::operator delete(p, std::align_val_t(
+                               alignment > detail::__resource_alignment
+                                   ? alignment
+                                   : detail::__resource_alignment));
+      return;
+    }
+    __free_block *b = static_cast<__free_block *>(p);
+    b->next = m_classes[c].free;
+    m_classes[c].free = b;
+  }
+
+  void reset() noexcept {
+    for (size_t c = 0; c < m_classes.size(); ++c) {
+      m_classes[c].free = nullptr;
+      for (void *slab : m_classes[c].slabs)
+        carve(c, slab);
+    }
+  }
+
+private:
+  struct __free_block {
+    __free_block *next;
+  };
+
+  struct __size_class {
+    __free_block *free = nullptr;
+    std::vector<void *> slabs;
+  };
+
+  static size_t size_class(size_t bytes) noexcept {
+    size_t c = 0;
+    while ((min_block_bytes << c) < bytes)
+      ++c;
+    return c;
+  }
+
+  size_t slab_size(size_t c) const noexcept {
+    const size_t block = min_block_bytes << c;
+    return block > m_slab_bytes ? block : m_slab_bytes / block * block;
+  }
+
+  void carve(size_t c, void *slab) noexcept {
+    const size_t block = min_block_bytes << c;
+    char *p = static_cast<char *>(slab);
+    for (size_t offset = slab_size(c); offset >= block;) {
+      offset -= block;
+      __free_block *b = reinterpret_cast<__free_block *>(p + offset);
+      b->next = m_classes[c].free;
+      m_classes[c].free = b;
+    }
+  }
+
+  void grow(size_t c) {
+    m_classes[c].slabs.reserve(m_classes[c].slabs.size() + 1);
+    void *slab = detail::__resource_upstream_allocate(slab_size(c));
+    m_classes[c].slabs.push_back(slab);
+    carve(c, slab);
+  }
+
+  size_t m_slab_bytes;
+  std::vector<__size_class> m_classes;
+};
+
+//==============================================================================
+// resource_allocator
+//
+// Allocator drawing from a Resource such as arena_resource or pool_resource,
+// which must outlive it and every container using it. Like
+// std::pmr::polymorphic_allocator, it converts implicitly from a pointer to
+// the resource, so the allocator constructors of mdarray take that pointer:
+//
+//   arena_resource arena;
+//   for (int step = 0; step < steps; ++step) {
+//     {
+//       arena_mdarray<double, dextents<int, 2>> tmp(dextents<int, 2>(n, m), &arena);
+//       ...
+//     }
+//     arena.reset();
+//   }
+//
+// There is no default constructor, so a container can not silently fall back
+// to another allocator.
+
+template <class ElementType, class Resource>
+struct resource_allocator {
+  using value_type = ElementType;
+  using resource_type = Resource;
+
+  template <class OtherElementType>
+  struct rebind {
+    using other = resource_allocator<OtherElementType, Resource>;
+  };
+
+  constexpr resource_allocator(Resource *r) noexcept : m_resource(r) {}
+
+  template <class OtherElementType>
+  constexpr resource_allocator(
+      const resource_allocator<OtherElementType, Resource> &other) noexcept
+      : m_resource(&other.resource()) {}
+
+  ElementType *allocate(size_t n) {
+    return static_cast<ElementType *>(
+        m_resource->allocate(n * sizeof(ElementType), alignof(ElementType)));
+  }
+
+  void deallocate(ElementType *p, size_t n) noexcept {
+    m_resource->deallocate(p, n * sizeof(ElementType), alignof(ElementType));
+  }
+
+  constexpr Resource &resource() const noexcept { return *m_resource; }
+
+  template <class OtherElementType>
+  friend constexpr bool
+  operator==(const resource_allocator &a,
+             const resource_allocator<OtherElementType, Resource> &b) noexcept {
+    return &a.resource() == &b.resource();
+  }
+
+  template <class OtherElementType>
+  friend constexpr bool
+  operator!=(const resource_allocator &a,
+             const resource_allocator<OtherElementType, Resource> &b) noexcept {
+    return !(a == b);
+  }
+
+private:
+  Resource *m_resource;
+};
+
+template <class ElementType>
+using arena_allocator = resource_allocator<ElementType, arena_resource>;
+
+template <class ElementType>
+using pool_allocator = resource_allocator<ElementType, pool_resource>;
+
+// Containers for mdarray drawing from an arena or a pool.
+template <class ElementType>
+using arena_vector = std::vector<ElementType, arena_allocator<ElementType>>;
+
+template <class ElementType>
+using pool_vector = std::vector<ElementType, pool_allocator<ElementType>>;
+
+template <class ElementType, class Extents, class LayoutPolicy = layout_right>
+using arena_mdarray =
+    mdarray<ElementType, Extents, LayoutPolicy, arena_vector<ElementType>>;
+
+template <class ElementType, class Extents, class LayoutPolicy = layout_right>
+using pool_mdarray =
+    mdarray<ElementType, Extents, LayoutPolicy, pool_vector<ElementType>>;
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
@@ -19,8 +19,92 @@
 #include "submdspan_extents.hpp"
 #include "submdspan_mapping.hpp"
 
+#include <numeric>
+
 namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
 namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// A number stride(r) of a strided mapping is always a multiple of, used to
+// tell how far a submdspan offset preserves alignment. Dynamic extents only
+// contribute a factor of one. Layouts with known stride factors specialize
+// this. Mappings that are not always strided have no strides to speak of, and
+// their offsets are not bounded by it.
+template <class Mapping, class = void>
+struct __stride_multiple {
+  MDSPAN_INLINE_FUNCTION
+  static constexpr size_t value(size_t) { return 1; }
+};
+
+template <class Extents>
+struct __stride_multiple<layout_left::mapping<Extents>> {
+  MDSPAN_INLINE_FUNCTION
+  static constexpr size_t value(size_t r) {
+    size_t result = 1;
+    for (size_t k = 0; k < r; ++k)
+      if (Extents::static_extent(k) != dynamic_extent)
+        result *= Extents::static_extent(k);
+    return result;
+  }
+};
+
+template <class Extents>
+struct __stride_multiple<layout_right::mapping<Extents>> {
+  MDSPAN_INLINE_FUNCTION
+  static constexpr size_t value(size_t r) {
+    size_t result = 1;
+    for (size_t k = r + 1; k < Extents::rank(); ++k)
+      if (Extents::static_extent(k) != dynamic_extent)
+        result *= Extents::static_extent(k);
+    return result;
+  }
+};
+
+template <class T>
+struct __is_integral_constant : std::false_type {};
+
+template <class T, T Value>
+struct __is_integral_constant<std::integral_constant<T, Value>> : std::true_type {};
+
+// A number the contribution of one slice to the submdspan offset is always a
+// multiple of; zero if the contribution is always zero.
+template <class Slice>
+MDSPAN_INLINE_FUNCTION
+constexpr size_t __slice_offset_multiple(size_t stride_multiple) {
+  using first_t = std::remove_cv_t<std::remove_reference_t<
+      decltype(first_of(std::declval<const Slice &>()))>>;
+  if constexpr (__is_integral_constant<first_t>::value) {
+    return static_cast<size_t>(first_t::value) * stride_multiple;
+  } else {
+    return stride_multiple;
+  }
+}
+
+// A number the submdspan offset is always a multiple of; one if nothing is
+// known about it, which is all that can be said for mappings that are not
+// always strided.
+template <class Mapping, class... SliceSpecifiers, size_t... Idx>
+MDSPAN_INLINE_FUNCTION
+constexpr size_t __submdspan_offset_multiple(std::index_sequence<Idx...>) {
+  if constexpr (!Mapping::is_always_strided())
+    return 1;
+  size_t result = 0;
+  ((result = std::gcd(result, __slice_offset_multiple<SliceSpecifiers>(
+                                  __stride_multiple<Mapping>::value(Idx)))),
+   ...);
+  return result;
+}
+
+// Accessor of a submdspan whose data handle is offset by a multiple of
+// OffsetMultiple elements (zero: not offset at all). Accessors specialize
+// this to keep properties which survive such offsets.
+template <class AccessorPolicy, size_t OffsetMultiple>
+struct __submdspan_accessor {
+  using type = typename AccessorPolicy::offset_policy;
+};
+
+} // namespace detail
+
 template <class ElementType, class Extents, class LayoutPolicy,
           class AccessorPolicy, class... SliceSpecifiers>
 MDSPAN_INLINE_FUNCTION
@@ -32,7 +116,12 @@ submdspan(const mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy> &src,
   using sub_mapping_t = std::remove_cv_t<decltype(sub_mapping_offset.mapping)>;
   using sub_extents_t = typename sub_mapping_t::extents_type;
   using sub_layout_t = typename sub_mapping_t::layout_type;
-  using sub_accessor_t = typename AccessorPolicy::offset_policy;
+  using sub_accessor_t = typename detail::__submdspan_accessor<
+      AccessorPolicy,
+      detail::__submdspan_offset_multiple<
+          typename mdspan<ElementType, Extents, LayoutPolicy,
+                          AccessorPolicy>::mapping_type,
+          SliceSpecifiers...>(std::index_sequence_for<SliceSpecifiers...>())>::type;
   return mdspan<ElementType, sub_extents_t, sub_layout_t, sub_accessor_t>(
       src.accessor().offset(src.data_handle(), sub_mapping_offset.offset),
       sub_mapping_offset.mapping,
@@ -0,0 +1,834 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../__p0009_bits/dynamic_extent.hpp"
+#include "../__p0009_bits/extents.hpp"
+#include "../__p0009_bits/layout_left.hpp"
+#include "../__p0009_bits/layout_right.hpp"
+#include "../__p0009_bits/layout_stride.hpp"
+#include "../__p2630_bits/submdspan.hpp"
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+
+//==============================================================================
+// layout_left_padded / layout_right_padded (P2642)
+//
+// Like layout_left (layout_right), except that the stride of dimension 1
+// (rank - 2) is extent(0) (extent(rank - 1)) rounded up to a multiple of the
+// padding value, so that every column (row) starts on an aligned boundary.
+
+template <size_t PaddingValue = dynamic_extent>
+struct layout_left_padded {
+  template <class Extents>
+  class mapping;
+};
+
+template <size_t PaddingValue = dynamic_extent>
+struct layout_right_padded {
+  template <class Extents>
+  class mapping;
+};
+
+namespace detail {
+
+// Least multiple of alignment which is at least offset. An alignment of zero
+// means no padding.
+template <class T>
+MDSPAN_INLINE_FUNCTION
+constexpr T __find_aligned_offset(T alignment, T offset) {
+  return alignment == 0 ? offset
+                        : ((offset + alignment - 1) / alignment) * alignment;
+}
+
+template <class ExtentsType, size_t PaddingValue, size_t ExtentToPadIdx>
+MDSPAN_INLINE_FUNCTION
+constexpr size_t __get_actual_static_padding_value() {
+  constexpr auto rank = ExtentsType::rank();
+  if constexpr (rank <= 1) {
+    return 0;
+  } else if constexpr (PaddingValue != dynamic_extent &&
+                       ExtentsType::static_extent(ExtentToPadIdx) !=
+                           dynamic_extent) {
+    return __find_aligned_offset(PaddingValue,
+                                 ExtentsType::static_extent(ExtentToPadIdx));
+  } else {
+    return dynamic_extent;
+  }
+}
+
+template <class Layout>
+struct __is_layout_left_padded : std::false_type {};
+
+template <size_t PaddingValue>
+struct __is_layout_left_padded<layout_left_padded<PaddingValue>>
+    : std::true_type {};
+
+template <class Layout>
+struct __is_layout_right_padded : std::false_type {};
+
+template <size_t PaddingValue>
+struct __is_layout_right_padded<layout_right_padded<PaddingValue>>
+    : std::true_type {};
+
+template <class Mapping, class = void>
+struct __is_layout_left_padded_mapping : std::false_type {};
+
+template <class Mapping>
+struct __is_layout_left_padded_mapping<
+    Mapping, std::enable_if_t<__is_layout_left_padded<
+                 typename Mapping::layout_type>::value>> : std::true_type {};
+
+template <class Mapping, class = void>
+struct __is_layout_right_padded_mapping : std::false_type {};
+
+template <class Mapping>
+struct __is_layout_right_padded_mapping<
+    Mapping, std::enable_if_t<__is_layout_right_padded<
+                 typename Mapping::layout_type>::value>> : std::true_type {};
+
+// Whether a slice keeps a contiguous range of a dimension.
+template <class Slice>
+constexpr bool __is_range_slice_v =
+    std::is_same_v<Slice, full_extent_t> ||
+    std::is_convertible_v<Slice, std::tuple<size_t, size_t>>;
+
+// The padded stride survives slicing if the kept dimensions are the leading
+// (layout_left) or trailing (layout_right) ones, and only the outermost and
+// innermost kept dimensions are narrowed: every stride in between depends on
+// the full extents.
+template <class IndexSequence, size_t SubRank, class... SliceSpecifiers>
+struct __preserve_layout_left_padded_mapping;
+
+template <class... SliceSpecifiers, size_t... Idx, size_t SubRank>
+struct __preserve_layout_left_padded_mapping<std::index_sequence<Idx...>,
+                                             SubRank, SliceSpecifiers...> {
+  constexpr static bool value =
+      (SubRank >= 2) &&
+      (((Idx >= SubRank) || // these are only integral slice specifiers
+        std::is_same_v<SliceSpecifiers, full_extent_t> ||
+        ((Idx == 0 || Idx == SubRank - 1) &&
+         __is_range_slice_v<SliceSpecifiers>)) &&
+       ...);
+};
+
+template <class IndexSequence, size_t SubRank, class... SliceSpecifiers>
+struct __preserve_layout_right_padded_mapping;
+
+template <class... SliceSpecifiers, size_t... Idx, size_t SubRank>
+struct __preserve_layout_right_padded_mapping<std::index_sequence<Idx...>,
+                                              SubRank, SliceSpecifiers...> {
+  constexpr static size_t SrcRank = sizeof...(SliceSpecifiers);
+  constexpr static bool value =
+      (SubRank >= 2) &&
+      (((Idx < SrcRank - SubRank) || // these are only integral slice specifiers
+        std::is_same_v<SliceSpecifiers, full_extent_t> ||
+        ((Idx == SrcRank - SubRank || Idx == SrcRank - 1) &&
+         __is_range_slice_v<SliceSpecifiers>)) &&
+       ...);
+};
+
+} // namespace detail
+
+//==============================================================================
+
+template <size_t PaddingValue>
+template <class Extents>
+class layout_left_padded<PaddingValue>::mapping {
+public:
+  static constexpr size_t padding_value = PaddingValue;
+
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_left_padded<padding_value>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_left_padded::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr rank_type __rank = extents_type::rank();
+  static constexpr rank_type __extent_to_pad_idx = 0;
+
+public:
+  // Stride of dimension 1 if it is known at compile time.
+  static constexpr size_t static_padding_stride =
+      detail::__get_actual_static_padding_value<extents_type, padding_value,
+                                                __extent_to_pad_idx>();
+
+private:
+  // Empty unless the padded stride is only known at runtime.
+  using __padded_stride_type =
+      ::MDSPAN_IMPL_STANDARD_NAMESPACE::extents<index_type, static_padding_stride>;
+
+  _MDSPAN_NO_UNIQUE_ADDRESS __padded_stride_type __padded_stride = {};
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+  MDSPAN_INLINE_FUNCTION
+  static constexpr __padded_stride_type
+  __init_padding(const extents_type &exts, index_type padding) {
+    if constexpr (__rank <= 1) {
+      (void)exts;
+      (void)padding;
+      return {};
+    } else {
+      return __padded_stride_type(detail::__find_aligned_offset(
+          padding, exts.extent(__extent_to_pad_idx)));
+    }
+  }
+
+  template <class OtherMapping>
+  MDSPAN_INLINE_FUNCTION
+  static constexpr __padded_stride_type
+  __padding_from_stride(const OtherMapping &other) {
+    if constexpr (__rank <= 1) {
+      (void)other;
+      return {};
+    } else {
+      return __padded_stride_type(static_cast<index_type>(other.stride(1)));
+    }
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping() noexcept : mapping(extents_type{}) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  // The padded stride is extent(0) rounded up to padding_value, or extent(0)
+  // itself if padding_value is dynamic.
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept
+      : __padded_stride(__init_padding(
+            exts, padding_value == dynamic_extent
+                      ? index_type(0)
+                      : static_cast<index_type>(padding_value))),
+        __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class Size,
+    /* requires */ (
+      std::is_convertible_v<Size, index_type> &&
+      std::is_nothrow_constructible_v<index_type, Size>
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts, Size padding)
+      : __padded_stride(__init_padding(exts, static_cast<index_type>(padding))),
+        __extents(exts) {
+    #if !defined(_MDSPAN_HAS_CUDA) && !defined(_MDSPAN_HAS_HIP) && !defined(NDEBUG)
+    if (padding_value != dynamic_extent &&
+        static_cast<index_type>(padding) != static_cast<index_type>(padding_value)) {
+      throw std::runtime_error("layout_left_padded: padding does not match the static padding_value.");
+    }
+    #endif
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const layout_left::mapping<OtherExtents> &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const layout_stride::mapping<OtherExtents> &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {
+    #if !defined(_MDSPAN_HAS_CUDA) && !defined(_MDSPAN_HAS_HIP) && !defined(NDEBUG)
+    for (rank_type r = 0; r < __rank; ++r) {
+      if (stride(r) != static_cast<index_type>(other.stride(r))) {
+        throw std::runtime_error("Assigning layout_stride to layout_left_padded with invalid strides.");
+      }
+    }
+    #endif
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_left_padded_mapping<OtherMapping>::value &&
+      std::is_constructible_v<extents_type, typename OtherMapping::extents_type>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((
+    !std::is_convertible_v<typename OtherMapping::extents_type, extents_type> ||
+    (__rank > 1 && static_padding_stride != dynamic_extent &&
+     OtherMapping::static_padding_stride == dynamic_extent)))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const OtherMapping &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {
+    static_assert(__rank <= 1 ||
+                  static_padding_stride == dynamic_extent ||
+                  OtherMapping::static_padding_stride == dynamic_extent ||
+                  static_padding_stride == OtherMapping::static_padding_stride,
+                  "layout_left_padded: incompatible static padding strides.");
+  }
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr std::array<index_type, extents_type::rank()> strides() const noexcept {
+    std::array<index_type, extents_type::rank()> result{};
+    for (rank_type r = 0; r < __rank; ++r)
+      result[r] = stride(r);
+    return result;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    if constexpr (__rank == 0) {
+      return 1;
+    } else if constexpr (__rank == 1) {
+      return __extents.extent(0);
+    } else {
+      index_type outer = 1;
+      for (rank_type r = 1; r < __rank; ++r)
+        outer *= __extents.extent(r);
+      if (outer == 0 || __extents.extent(0) == 0)
+        return 0;
+      return __extents.extent(0) + __padded_stride.extent(0) * (outer - 1);
+    }
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class... Indices,
+    /* requires */ (
+      (sizeof...(Indices) == extents_type::rank()) &&
+      (std::is_convertible_v<Indices, index_type> && ...) &&
+      (std::is_nothrow_constructible_v<index_type, Indices> && ...)
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(Indices... idxs) const noexcept {
+    if constexpr (__rank == 0) {
+      return 0;
+    } else {
+      // i0 + S * (i1 + E(1) * (i2 + E(2) * i3))
+      const index_type idx[] = {static_cast<index_type>(idxs)...};
+      index_type offset = idx[__rank - 1];
+      for (rank_type r = __rank - 1; r-- > 1;)
+        offset = offset * __extents.extent(r) + idx[r];
+      if constexpr (__rank > 1)
+        offset = offset * __padded_stride.extent(0) + idx[0];
+      return offset;
+    }
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      return static_padding_stride != dynamic_extent &&
+             extents_type::static_extent(__extent_to_pad_idx) != dynamic_extent &&
+             static_padding_stride == extents_type::static_extent(__extent_to_pad_idx);
+    }
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      return __padded_stride.extent(0) == __extents.extent(__extent_to_pad_idx);
+    }
+  }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept
+#if MDSPAN_HAS_CXX_20
+    requires ( Extents::rank() > 0 )
+#endif
+  {
+    if (r == 0)
+      return 1;
+    index_type value = __padded_stride.extent(0);
+    for (rank_type k = 1; k < r; ++k)
+      value *= __extents.extent(k);
+    return value;
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_left_padded_mapping<OtherMapping>::value &&
+      (OtherMapping::extents_type::rank() == extents_type::rank())
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const OtherMapping &rhs) noexcept {
+    if constexpr (__rank <= 1) {
+      return lhs.extents() == rhs.extents();
+    } else {
+      return lhs.extents() == rhs.extents() && lhs.stride(1) == rhs.stride(1);
+    }
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_left_padded_mapping<OtherMapping>::value &&
+      (OtherMapping::extents_type::rank() == extents_type::rank())
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const OtherMapping &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+
+  // Keeps layout_left_padded where possible, see
+  // __preserve_layout_left_padded_mapping.
+  template <class... SliceSpecifiers>
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr auto submdspan_mapping(const mapping &src,
+                                          SliceSpecifiers... slices) {
+    auto dst_ext = submdspan_extents(src.extents(), slices...);
+    using dst_ext_t = decltype(dst_ext);
+    using seq_t = std::make_index_sequence<__rank>;
+    const auto offset = static_cast<size_t>(src(detail::first_of(slices)...));
+
+    if constexpr (dst_ext_t::rank() == 0 ||
+                  (dst_ext_t::rank() == 1 &&
+                   ::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::preserve_layout_left_mapping<
+                       seq_t, 1, SliceSpecifiers...>::value)) {
+      using dst_mapping_t = layout_left::mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{dst_mapping_t(dst_ext), offset};
+    } else if constexpr (detail::__preserve_layout_left_padded_mapping<
+                             seq_t, dst_ext_t::rank(), SliceSpecifiers...>::value) {
+      using dst_mapping_t = typename layout_left_padded<
+          static_padding_stride>::template mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{
+          dst_mapping_t(dst_ext, src.stride(1)), offset};
+    } else {
+      using dst_mapping_t = layout_stride::mapping<dst_ext_t>;
+      auto inv_map = detail::inv_map_rank(std::integral_constant<size_t, 0>(),
+                                          std::index_sequence<>(), slices...);
+      return mapping_offset<dst_mapping_t>{
+          dst_mapping_t(dst_ext,
+                        ::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::construct_sub_strides(
+                            src, inv_map,
+                            std::tuple<decltype(detail::stride_of(slices))...>{
+                                detail::stride_of(slices)...})),
+          offset};
+    }
+  }
+};
+
+//==============================================================================
+
+template <size_t PaddingValue>
+template <class Extents>
+class layout_right_padded<PaddingValue>::mapping {
+public:
+  static constexpr size_t padding_value = PaddingValue;
+
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using layout_type = layout_right_padded<padding_value>;
+
+private:
+  static_assert(::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::__is_extents_v<extents_type>,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::layout_right_padded::mapping must be instantiated with a specialization of " MDSPAN_IMPL_STANDARD_NAMESPACE_STRING "::extents.");
+
+  template <class>
+  friend class mapping;
+
+  static constexpr rank_type __rank = extents_type::rank();
+  static constexpr rank_type __extent_to_pad_idx = __rank > 0 ? __rank - 1 : 0;
+  static constexpr rank_type __padded_stride_idx = __rank > 1 ? __rank - 2 : 0;
+
+public:
+  // Stride of dimension rank() - 2 if it is known at compile time.
+  static constexpr size_t static_padding_stride =
+      detail::__get_actual_static_padding_value<extents_type, padding_value,
+                                                __extent_to_pad_idx>();
+
+private:
+  // Empty unless the padded stride is only known at runtime.
+  using __padded_stride_type =
+      ::MDSPAN_IMPL_STANDARD_NAMESPACE::extents<index_type, static_padding_stride>;
+
+  _MDSPAN_NO_UNIQUE_ADDRESS __padded_stride_type __padded_stride = {};
+  _MDSPAN_NO_UNIQUE_ADDRESS extents_type __extents = {};
+
+  MDSPAN_INLINE_FUNCTION
+  static constexpr __padded_stride_type
+  __init_padding(const extents_type &exts, index_type padding) {
+    if constexpr (__rank <= 1) {
+      (void)exts;
+      (void)padding;
+      return {};
+    } else {
+      return __padded_stride_type(detail::__find_aligned_offset(
+          padding, exts.extent(__extent_to_pad_idx)));
+    }
+  }
+
+  template <class OtherMapping>
+  MDSPAN_INLINE_FUNCTION
+  static constexpr __padded_stride_type
+  __padding_from_stride(const OtherMapping &other) {
+    if constexpr (__rank <= 1) {
+      (void)other;
+      return {};
+    } else {
+      return __padded_stride_type(
+          static_cast<index_type>(other.stride(__padded_stride_idx)));
+    }
+  }
+
+public:
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping() noexcept : mapping(extents_type{}) {}
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr mapping(const mapping &) noexcept = default;
+
+  // The padded stride is extent(rank() - 1) rounded up to padding_value, or
+  // extent(rank() - 1) itself if padding_value is dynamic.
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts) noexcept
+      : __padded_stride(__init_padding(
+            exts, padding_value == dynamic_extent
+                      ? index_type(0)
+                      : static_cast<index_type>(padding_value))),
+        __extents(exts) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class Size,
+    /* requires */ (
+      std::is_convertible_v<Size, index_type> &&
+      std::is_nothrow_constructible_v<index_type, Size>
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const extents_type &exts, Size padding)
+      : __padded_stride(__init_padding(exts, static_cast<index_type>(padding))),
+        __extents(exts) {
+    #if !defined(_MDSPAN_HAS_CUDA) && !defined(_MDSPAN_HAS_HIP) && !defined(NDEBUG)
+    if (padding_value != dynamic_extent &&
+        static_cast<index_type>(padding) != static_cast<index_type>(padding_value)) {
+      throw std::runtime_error("layout_right_padded: padding does not match the static padding_value.");
+    }
+    #endif
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((!std::is_convertible_v<OtherExtents, extents_type>))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const layout_right::mapping<OtherExtents> &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherExtents,
+    /* requires */ (
+      std::is_constructible_v<extents_type, OtherExtents>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((extents_type::rank() > 0))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const layout_stride::mapping<OtherExtents> &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {
+    #if !defined(_MDSPAN_HAS_CUDA) && !defined(_MDSPAN_HAS_HIP) && !defined(NDEBUG)
+    for (rank_type r = 0; r < __rank; ++r) {
+      if (stride(r) != static_cast<index_type>(other.stride(r))) {
+        throw std::runtime_error("Assigning layout_stride to layout_right_padded with invalid strides.");
+      }
+    }
+    #endif
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_right_padded_mapping<OtherMapping>::value &&
+      std::is_constructible_v<extents_type, typename OtherMapping::extents_type>
+    )
+  )
+  MDSPAN_CONDITIONAL_EXPLICIT((
+    !std::is_convertible_v<typename OtherMapping::extents_type, extents_type> ||
+    (__rank > 1 && static_padding_stride != dynamic_extent &&
+     OtherMapping::static_padding_stride == dynamic_extent)))
+  MDSPAN_INLINE_FUNCTION
+  constexpr mapping(const OtherMapping &other)
+      : __padded_stride(__padding_from_stride(other)),
+        __extents(other.extents()) {
+    static_assert(__rank <= 1 ||
+                  static_padding_stride == dynamic_extent ||
+                  OtherMapping::static_padding_stride == dynamic_extent ||
+                  static_padding_stride == OtherMapping::static_padding_stride,
+                  "layout_right_padded: incompatible static padding strides.");
+  }
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED _MDSPAN_CONSTEXPR_14_DEFAULTED mapping &operator=(const mapping &) noexcept = default;
+
+  //--------------------------------------------------------------------------------
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr const extents_type &extents() const noexcept { return __extents; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr std::array<index_type, extents_type::rank()> strides() const noexcept {
+    std::array<index_type, extents_type::rank()> result{};
+    for (rank_type r = 0; r < __rank; ++r)
+      result[r] = stride(r);
+    return result;
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type required_span_size() const noexcept {
+    if constexpr (__rank == 0) {
+      return 1;
+    } else if constexpr (__rank == 1) {
+      return __extents.extent(0);
+    } else {
+      index_type outer = 1;
+      for (rank_type r = 0; r < __rank - 1; ++r)
+        outer *= __extents.extent(r);
+      if (outer == 0 || __extents.extent(__extent_to_pad_idx) == 0)
+        return 0;
+      return __extents.extent(__extent_to_pad_idx) +
+             __padded_stride.extent(0) * (outer - 1);
+    }
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class... Indices,
+    /* requires */ (
+      (sizeof...(Indices) == extents_type::rank()) &&
+      (std::is_convertible_v<Indices, index_type> && ...) &&
+      (std::is_nothrow_constructible_v<index_type, Indices> && ...)
+    )
+  )
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr index_type operator()(Indices... idxs) const noexcept {
+    if constexpr (__rank == 0) {
+      return 0;
+    } else {
+      // i3 + S * (i2 + E(2) * (i1 + E(1) * i0))
+      const index_type idx[] = {static_cast<index_type>(idxs)...};
+      index_type offset = idx[0];
+      for (rank_type r = 1; r + 1 < __rank; ++r)
+        offset = offset * __extents.extent(r) + idx[r];
+      if constexpr (__rank > 1)
+        offset = offset * __padded_stride.extent(0) + idx[__rank - 1];
+      return offset;
+    }
+  }
+
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_unique() noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_exhaustive() noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      return static_padding_stride != dynamic_extent &&
+             extents_type::static_extent(__extent_to_pad_idx) != dynamic_extent &&
+             static_padding_stride == extents_type::static_extent(__extent_to_pad_idx);
+    }
+  }
+  MDSPAN_INLINE_FUNCTION static constexpr bool is_always_strided() noexcept { return true; }
+
+  MDSPAN_INLINE_FUNCTION constexpr bool is_unique() const noexcept { return true; }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_exhaustive() const noexcept {
+    if constexpr (__rank <= 1) {
+      return true;
+    } else {
+      return __padded_stride.extent(0) == __extents.extent(__extent_to_pad_idx);
+    }
+  }
+  MDSPAN_INLINE_FUNCTION constexpr bool is_strided() const noexcept { return true; }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr index_type stride(rank_type r) const noexcept
+#if MDSPAN_HAS_CXX_20
+    requires ( Extents::rank() > 0 )
+#endif
+  {
+    if (r + 1 == __rank)
+      return 1;
+    index_type value = __padded_stride.extent(0);
+    for (rank_type k = r + 1; k + 1 < __rank; ++k)
+      value *= __extents.extent(k);
+    return value;
+  }
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_right_padded_mapping<OtherMapping>::value &&
+      (OtherMapping::extents_type::rank() == extents_type::rank())
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator==(const mapping &lhs, const OtherMapping &rhs) noexcept {
+    if constexpr (__rank <= 1) {
+      return lhs.extents() == rhs.extents();
+    } else {
+      return lhs.extents() == rhs.extents() &&
+             lhs.stride(__padded_stride_idx) == rhs.stride(__padded_stride_idx);
+    }
+  }
+
+#if !(MDSPAN_HAS_CXX_20)
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherMapping,
+    /* requires */ (
+      detail::__is_layout_right_padded_mapping<OtherMapping>::value &&
+      (OtherMapping::extents_type::rank() == extents_type::rank())
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr bool operator!=(const mapping &lhs, const OtherMapping &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+#endif
+
+  // Keeps layout_right_padded where possible, see
+  // __preserve_layout_right_padded_mapping.
+  template <class... SliceSpecifiers>
+  MDSPAN_INLINE_FUNCTION
+  friend constexpr auto submdspan_mapping(const mapping &src,
+                                          SliceSpecifiers... slices) {
+    auto dst_ext = submdspan_extents(src.extents(), slices...);
+    using dst_ext_t = decltype(dst_ext);
+    using seq_t = std::make_index_sequence<__rank>;
+    const auto offset = static_cast<size_t>(src(detail::first_of(slices)...));
+
+    if constexpr (dst_ext_t::rank() == 0 ||
+                  (dst_ext_t::rank() == 1 &&
+                   ::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::preserve_layout_right_mapping<
+                       seq_t, 1, SliceSpecifiers...>::value)) {
+      using dst_mapping_t = layout_right::mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{dst_mapping_t(dst_ext), offset};
+    } else if constexpr (detail::__preserve_layout_right_padded_mapping<
+                             seq_t, dst_ext_t::rank(), SliceSpecifiers...>::value) {
+      using dst_mapping_t = typename layout_right_padded<
+          static_padding_stride>::template mapping<dst_ext_t>;
+      return mapping_offset<dst_mapping_t>{
+          dst_mapping_t(dst_ext, src.stride(__padded_stride_idx)), offset};
+    } else {
+      using dst_mapping_t = layout_stride::mapping<dst_ext_t>;
+      auto inv_map = detail::inv_map_rank(std::integral_constant<size_t, 0>(),
+                                          std::index_sequence<>(), slices...);
+      return mapping_offset<dst_mapping_t>{
+          dst_mapping_t(dst_ext,
+                        ::MDSPAN_IMPL_STANDARD_NAMESPACE::detail::construct_sub_strides(
+                            src, inv_map,
+                            std::tuple<decltype(detail::stride_of(slices))...>{
+                                detail::stride_of(slices)...})),
+          offset};
+    }
+  }
+};
+
+namespace detail {
+
+// The padded stride is a multiple of the padding value even if the extent it
+// pads is not known.
+template <class Mapping>
+MDSPAN_INLINE_FUNCTION
+constexpr size_t __padded_stride_multiple() {
+  if constexpr (Mapping::static_padding_stride != dynamic_extent)
+    return Mapping::static_padding_stride;
+  else if constexpr (Mapping::padding_value != dynamic_extent)
+    return Mapping::padding_value;
+  else
+    return 1;
+}
+
+template <class Mapping>
+struct __stride_multiple<
+    Mapping, std::enable_if_t<__is_layout_left_padded_mapping<Mapping>::value>> {
+  MDSPAN_INLINE_FUNCTION
+  static constexpr size_t value(size_t r) {
+    using Extents = typename Mapping::extents_type;
+    if (r == 0)
+      return 1;
+    size_t result = __padded_stride_multiple<Mapping>();
+    for (size_t k = 1; k < r; ++k)
+      if (Extents::static_extent(k) != dynamic_extent)
+        result *= Extents::static_extent(k);
+    return result;
+  }
+};
+
+template <class Mapping>
+struct __stride_multiple<
+    Mapping, std::enable_if_t<__is_layout_right_padded_mapping<Mapping>::value>> {
+  MDSPAN_INLINE_FUNCTION
+  static constexpr size_t value(size_t r) {
+    using Extents = typename Mapping::extents_type;
+    if (r + 1 == Extents::rank())
+      return 1;
+    size_t result = __padded_stride_multiple<Mapping>();
+    for (size_t k = r + 1; k + 1 < Extents::rank(); ++k)
+      if (Extents::static_extent(k) != dynamic_extent)
+        result *= Extents::static_extent(k);
+    return result;
+  }
+};
+
+} // namespace detail
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
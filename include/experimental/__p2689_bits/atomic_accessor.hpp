@@ -0,0 +1,254 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/macros.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+// Strongest orders valid for loads and for stores that are implied by a
+// read-modify-write order.
+constexpr std::memory_order __load_order(std::memory_order order) noexcept {
+  return order == std::memory_order_acq_rel   ? std::memory_order_acquire
+         : order == std::memory_order_release ? std::memory_order_relaxed
+                                              : order;
+}
+
+constexpr std::memory_order __store_order(std::memory_order order) noexcept {
+  return order == std::memory_order_acq_rel ? std::memory_order_release
+         : (order == std::memory_order_acquire ||
+            order == std::memory_order_consume)
+             ? std::memory_order_relaxed
+             : order;
+}
+
+#if !defined(__cpp_lib_atomic_ref) && (defined(__GNUC__) || defined(__clang__))
+constexpr int __gnu_atomic_order(std::memory_order order) noexcept {
+  return order == std::memory_order_relaxed   ? __ATOMIC_RELAXED
+         : order == std::memory_order_consume ? __ATOMIC_CONSUME
+         : order == std::memory_order_acquire ? __ATOMIC_ACQUIRE
+         : order == std::memory_order_release ? __ATOMIC_RELEASE
+         : order == std::memory_order_acq_rel ? __ATOMIC_ACQ_REL
+                                              : __ATOMIC_SEQ_CST;
+}
+#endif
+
+// Atomic operations on a non-atomic object, i.e. std::atomic_ref. Where the
+// standard library doesn't provide it yet they are implemented with the
+// GCC/Clang __atomic builtins.
+template <class T>
+struct __atomic_ops {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "Atomic operations require a trivially copyable type.");
+
+#if defined(__cpp_lib_atomic_ref)
+  static T load(T *p, std::memory_order order) noexcept {
+    return std::atomic_ref<T>(*p).load(order);
+  }
+  static void store(T *p, T v, std::memory_order order) noexcept {
+    std::atomic_ref<T>(*p).store(v, order);
+  }
+  static T exchange(T *p, T v, std::memory_order order) noexcept {
+    return std::atomic_ref<T>(*p).exchange(v, order);
+  }
+  static bool compare_exchange_weak(T *p, T &expected, T desired,
+                                    std::memory_order success,
+                                    std::memory_order failure) noexcept {
+    return std::atomic_ref<T>(*p).compare_exchange_weak(expected, desired,
+                                                        success, failure);
+  }
+  static T fetch_add(T *p, T v, std::memory_order order) noexcept {
+    return std::atomic_ref<T>(*p).fetch_add(v, order);
+  }
+  static T fetch_sub(T *p, T v, std::memory_order order) noexcept {
+    return std::atomic_ref<T>(*p).fetch_sub(v, order);
+  }
+#elif defined(__GNUC__) || defined(__clang__)
+  static T load(T *p, std::memory_order order) noexcept {
+    T result;
+    __atomic_load(p, &result, __gnu_atomic_order(order));
+    return result;
+  }
+  static void store(T *p, T v, std::memory_order order) noexcept {
+    __atomic_store(p, &v, __gnu_atomic_order(order));
+  }
+  static T exchange(T *p, T v, std::memory_order order) noexcept {
+    T result;
+    __atomic_exchange(p, &v, &result, __gnu_atomic_order(order));
+    return result;
+  }
+  static bool compare_exchange_weak(T *p, T &expected, T desired,
+                                    std::memory_order success,
+                                    std::memory_order failure) noexcept {
+    return __atomic_compare_exchange(p, &expected, &desired, true,
+                                     __gnu_atomic_order(success),
+                                     __gnu_atomic_order(failure));
+  }
+  static T fetch_add(T *p, T v, std::memory_order order) noexcept {
+    if constexpr (std::is_integral<T>::value) {
+      return __atomic_fetch_add(p, v, __gnu_atomic_order(order));
+    } else {
+      return __fetch_update(p, order, [v](T old) { return old + v; });
+    }
+  }
+  static T fetch_sub(T *p, T v, std::memory_order order) noexcept {
+    if constexpr (std::is_integral<T>::value) {
+      return __atomic_fetch_sub(p, v, __gnu_atomic_order(order));
+    } else {
+      return __fetch_update(p, order, [v](T old) { return old - v; });
+    }
+  }
+
+private:
+  template <class F>
+  static T __fetch_update(T *p, std::memory_order order, F f) noexcept {
+    T old = load(p, std::memory_order_relaxed);
+    while (!compare_exchange_weak(p, old, f(old), order,
+                                  std::memory_order_relaxed)) {
+    }
+    return old;
+  }
+#else
+  static_assert(std::is_void<T>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::atomic_accessor requires std::atomic_ref or the __atomic builtins.");
+#endif
+};
+
+} // namespace detail
+
+// Reference to an element of an mdspan using atomic_accessor: like
+// std::atomic_ref<ElementType>, but every operation defaults to MemoryOrder
+// (weakened to a valid order for plain loads and stores). Host only.
+template <class ElementType, std::memory_order MemoryOrder>
+class atomic_ref_bounded {
+  static_assert(!std::is_const<ElementType>::value,
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING
+                "::atomic_ref_bounded requires a non-const element type.");
+  using ops = detail::__atomic_ops<ElementType>;
+
+public:
+  using value_type = ElementType;
+  static constexpr std::memory_order memory_order = MemoryOrder;
+
+  explicit atomic_ref_bounded(ElementType &obj) noexcept : ptr_(&obj) {}
+  atomic_ref_bounded(const atomic_ref_bounded &) noexcept = default;
+
+  value_type load(std::memory_order order = detail::__load_order(MemoryOrder)) const noexcept {
+    return ops::load(ptr_, order);
+  }
+  void store(value_type v, std::memory_order order = detail::__store_order(MemoryOrder)) const noexcept {
+    ops::store(ptr_, v, order);
+  }
+  operator value_type() const noexcept { return load(); }
+  value_type operator=(value_type v) const noexcept {
+    store(v);
+    return v;
+  }
+  atomic_ref_bounded &operator=(const atomic_ref_bounded &) = delete;
+
+  value_type exchange(value_type v, std::memory_order order = MemoryOrder) const noexcept {
+    return ops::exchange(ptr_, v, order);
+  }
+  bool compare_exchange_weak(value_type &expected, value_type desired,
+                             std::memory_order success = MemoryOrder,
+                             std::memory_order failure = detail::__load_order(MemoryOrder)) const noexcept {
+    return ops::compare_exchange_weak(ptr_, expected, desired, success, failure);
+  }
+
+  value_type fetch_add(value_type v, std::memory_order order = MemoryOrder) const noexcept {
+    return ops::fetch_add(ptr_, v, order);
+  }
+  value_type fetch_sub(value_type v, std::memory_order order = MemoryOrder) const noexcept {
+    return ops::fetch_sub(ptr_, v, order);
+  }
+  value_type operator+=(value_type v) const noexcept { return fetch_add(v) + v; }
+  value_type operator-=(value_type v) const noexcept { return fetch_sub(v) - v; }
+  value_type operator++() const noexcept { return *this += value_type(1); }
+  value_type operator++(int) const noexcept { return fetch_add(value_type(1)); }
+  value_type operator--() const noexcept { return *this -= value_type(1); }
+  value_type operator--(int) const noexcept { return fetch_sub(value_type(1)); }
+
+private:
+  ElementType *ptr_;
+};
+
+// Accessor whose reference performs every access atomically with the given
+// memory order, so that several threads may update the same mdspan
+// concurrently. Only the accessor is atomic: non-atomic accesses to the same
+// elements through other mdspans are still data races.
+template <class ElementType, std::memory_order MemoryOrder = std::memory_order_seq_cst>
+struct atomic_accessor {
+  using offset_policy = atomic_accessor;
+  using element_type = ElementType;
+  using reference = atomic_ref_bounded<ElementType, MemoryOrder>;
+  using data_handle_type = ElementType *;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr atomic_accessor() noexcept = default;
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr atomic_accessor(atomic_accessor<OtherElementType, MemoryOrder>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      _MDSPAN_TRAIT(std::is_convertible, OtherElementType(*)[], element_type(*)[])
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr atomic_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  reference access(data_handle_type p, size_t i) const noexcept {
+    return reference(p[i]);
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+template <class ElementType>
+using atomic_accessor_relaxed = atomic_accessor<ElementType, std::memory_order_relaxed>;
+template <class ElementType>
+using atomic_accessor_acq_rel = atomic_accessor<ElementType, std::memory_order_acq_rel>;
+template <class ElementType>
+using atomic_accessor_seq_cst = atomic_accessor<ElementType, std::memory_order_seq_cst>;
+
+// Relaxed atomic ref += v, for scatter-add kernels whose result is only read
+// after the threads have been joined. Returns the previous value.
+template <class ElementType, std::memory_order MemoryOrder>
+ElementType
+atomic_fetch_add_relaxed(const atomic_ref_bounded<ElementType, MemoryOrder> &ref,
+                         ElementType v) noexcept {
+  return ref.fetch_add(v, std::memory_order_relaxed);
+}
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
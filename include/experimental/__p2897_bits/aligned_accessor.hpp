@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#pragma once
+
+#include "../__p0009_bits/default_accessor.hpp"
+#include "../__p0009_bits/macros.hpp"
+#include "../__p2630_bits/submdspan.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace MDSPAN_IMPL_STANDARD_NAMESPACE {
+namespace MDSPAN_IMPL_PROPOSED_NAMESPACE {
+namespace detail {
+
+MDSPAN_INLINE_FUNCTION
+constexpr bool __is_valid_byte_alignment(size_t byte_alignment, size_t element_alignment) {
+  return byte_alignment != 0 && (byte_alignment & (byte_alignment - 1)) == 0 &&
+         byte_alignment >= element_alignment;
+}
+
+// Tells the compiler that p is aligned to ByteAlignment bytes, so that loads
+// and stores through it can use aligned vector instructions without a peeled
+// prologue.
+template <size_t ByteAlignment, class ElementType>
+MDSPAN_FORCE_INLINE_FUNCTION
+constexpr ElementType *__assume_aligned(ElementType *p) noexcept {
+#if defined(__cpp_lib_assume_aligned)
+  return std::assume_aligned<ByteAlignment>(p);
+#elif defined(__GNUC__) || defined(__clang__)
+  return static_cast<ElementType *>(__builtin_assume_aligned(p, ByteAlignment));
+#else
+  return p;
+#endif
+}
+
+} // namespace detail
+
+// Whether p may be used as the data handle of an
+// aligned_accessor<ElementType, ByteAlignment>.
+template <size_t ByteAlignment, class ElementType>
+MDSPAN_INLINE_FUNCTION
+bool is_sufficiently_aligned(ElementType *p) {
+  return reinterpret_cast<std::uintptr_t>(p) % ByteAlignment == 0;
+}
+
+// Accessor for data handles which are aligned to ByteAlignment bytes. Element
+// access is the same as for default_accessor, but the compiler is told about
+// the alignment.
+//
+// submdspan keeps as much of the alignment as the offset of the slice is
+// statically known to preserve, and falls back to default_accessor otherwise.
+template <class ElementType, size_t ByteAlignment>
+struct aligned_accessor {
+  static_assert(detail::__is_valid_byte_alignment(ByteAlignment, alignof(ElementType)),
+                MDSPAN_IMPL_PROPOSED_NAMESPACE_STRING "::aligned_accessor: ByteAlignment must be a power of two no less than alignof(ElementType).");
+
+  using offset_policy = default_accessor<ElementType>;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  static constexpr size_t byte_alignment = ByteAlignment;
+
+  MDSPAN_INLINE_FUNCTION_DEFAULTED constexpr aligned_accessor() noexcept = default;
+
+  // A stronger alignment may always be weakened.
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType, size_t OtherByteAlignment,
+    /* requires */ (
+      std::is_convertible_v<OtherElementType(*)[], element_type(*)[]> &&
+      OtherByteAlignment >= byte_alignment
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr aligned_accessor(aligned_accessor<OtherElementType, OtherByteAlignment>) noexcept {}
+
+  // The data handle must be checked by the caller, see is_sufficiently_aligned.
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      std::is_convertible_v<OtherElementType(*)[], element_type(*)[]>
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  explicit constexpr aligned_accessor(default_accessor<OtherElementType>) noexcept {}
+
+  MDSPAN_TEMPLATE_REQUIRES(
+    class OtherElementType,
+    /* requires */ (
+      std::is_convertible_v<element_type(*)[], OtherElementType(*)[]>
+    )
+  )
+  MDSPAN_INLINE_FUNCTION
+  constexpr operator default_accessor<OtherElementType>() const noexcept {
+    return {};
+  }
+
+  MDSPAN_FORCE_INLINE_FUNCTION
+  constexpr reference access(data_handle_type p, size_t i) const noexcept {
+    return detail::__assume_aligned<byte_alignment>(p)[i];
+  }
+
+  MDSPAN_INLINE_FUNCTION
+  constexpr typename offset_policy::data_handle_type
+  offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+namespace detail {
+
+// An offset of a multiple of OffsetMultiple elements keeps the largest power
+// of two dividing OffsetMultiple * sizeof(ElementType) bytes of alignment.
+template <class ElementType, size_t ByteAlignment, size_t OffsetMultiple>
+struct __submdspan_accessor<aligned_accessor<ElementType, ByteAlignment>,
+                            OffsetMultiple> {
+private:
+  static constexpr size_t __offset_bytes = OffsetMultiple * sizeof(ElementType);
+  static constexpr size_t __kept_alignment =
+      OffsetMultiple == 0
+          ? ByteAlignment
+          : std::min(ByteAlignment, __offset_bytes & (~__offset_bytes + 1));
+
+public:
+  using type = std::conditional_t<
+      (__kept_alignment > alignof(ElementType)),
+      aligned_accessor<ElementType, __kept_alignment>,
+      typename aligned_accessor<ElementType, ByteAlignment>::offset_policy>;
+};
+
+} // namespace detail
+
+} // namespace MDSPAN_IMPL_PROPOSED_NAMESPACE
+} // namespace MDSPAN_IMPL_STANDARD_NAMESPACE
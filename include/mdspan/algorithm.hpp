@@ -0,0 +1,41 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef MDSPAN_ALGORITHM_HPP_
+#define MDSPAN_ALGORITHM_HPP_
+
+#ifndef MDSPAN_IMPL_STANDARD_NAMESPACE
+  #define MDSPAN_IMPL_STANDARD_NAMESPACE Kokkos
+#endif
+
+#ifndef MDSPAN_IMPL_PROPOSED_NAMESPACE
+  #define MDSPAN_IMPL_PROPOSED_NAMESPACE Experimental
+#endif
+
+#include "mdspan.hpp"
+#if MDSPAN_HAS_CXX_17
+#include "../experimental/__algorithm_bits/copy.hpp"
+#include "../experimental/__algorithm_bits/for_each.hpp"
+#include "../experimental/__algorithm_bits/ranges.hpp"
+#include "../experimental/__algorithm_bits/reduce.hpp"
+#include "../experimental/__algorithm_bits/relayout.hpp"
+#include "../experimental/__algorithm_bits/stencil.hpp"
+#include "../experimental/__algorithm_bits/transform.hpp"
+#include "../experimental/__algorithm_bits/mask.hpp"
+#include "../experimental/__algorithm_bits/banded.hpp"
+#endif
+
+#endif // MDSPAN_ALGORITHM_HPP_
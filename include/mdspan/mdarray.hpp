@@ -27,5 +27,9 @@
 
 #include "mdspan.hpp"
 #include "../experimental/__p1684_bits/mdarray.hpp"
+#if MDSPAN_HAS_CXX_17
+#include "../experimental/__p1684_bits/aligned_allocator.hpp"
+#include "../experimental/__p1684_bits/resource_allocator.hpp"
+#endif
 
 #endif // MDARRAY_HPP_
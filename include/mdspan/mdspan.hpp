@@ -34,8 +34,26 @@
 #include "../experimental/__p0009_bits/layout_left.hpp"
 #include "../experimental/__p0009_bits/layout_right.hpp"
 #include "../experimental/__p0009_bits/macros.hpp"
+#include "../experimental/__accessor_bits/restrict_accessor.hpp"
 #if MDSPAN_HAS_CXX_17
 #include "../experimental/__p2630_bits/submdspan.hpp"
+#include "../experimental/__p2642_bits/layout_padded.hpp"
+#include "../experimental/__layout_bits/layout_blocked.hpp"
+#include "../experimental/__layout_bits/layout_cached.hpp"
+#include "../experimental/__layout_bits/layout_morton.hpp"
+#include "../experimental/__layout_bits/layout_hilbert.hpp"
+#include "../experimental/__layout_bits/layout_banded.hpp"
+#include "../experimental/__layout_bits/coalesce.hpp"
+#include "../experimental/__p2897_bits/aligned_accessor.hpp"
+#include "../experimental/__accessor_bits/non_temporal_accessor.hpp"
+#include "../experimental/__accessor_bits/prefetching_accessor.hpp"
+#include "../experimental/__p2689_bits/atomic_accessor.hpp"
+#include "../experimental/__p1673_bits/scaled_accessor.hpp"
+#include "../experimental/__p1673_bits/conjugated_accessor.hpp"
+#include "../experimental/__p1673_bits/layout_blas_packed.hpp"
+#include "../experimental/__accessor_bits/converting_accessor.hpp"
+#include "../experimental/__accessor_bits/quantized_accessor.hpp"
+#include "../experimental/__accessor_bits/packed_bool_accessor.hpp"
 #endif
 
 #endif // MDSPAN_HPP_
@@ -0,0 +1,99 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <complex>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+TEST(TestAccessorViews, scaled) {
+  std::vector<double> data(12);
+  std::iota(data.begin(), data.end(), 0.);
+  Kokkos::mdspan<double, Kokkos::extents<int, 3, dyn>> a(data.data(), 4);
+
+  auto sa = KokkosEx::scaled(2., a);
+  static_assert(std::is_same_v<decltype(sa)::element_type, const double>);
+  static_assert(std::is_same_v<decltype(sa)::reference, double>);
+  ASSERT_EQ(sa.extents(), a.extents());
+  ASSERT_EQ((__MDSPAN_OP(sa, 2, 3)), 22.);
+
+  // Nesting multiplies the factors; integer factors promote as in alpha * x.
+  auto ssa = KokkosEx::scaled(3, sa);
+  ASSERT_EQ((__MDSPAN_OP(ssa, 1, 1)), 30.);
+
+  // Slicing keeps the scaling factor.
+  auto row = KokkosEx::submdspan(sa, 1, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(row)::accessor_type, decltype(sa)::accessor_type>);
+  ASSERT_EQ(row.accessor().scaling_factor(), 2.);
+  ASSERT_EQ((__MDSPAN_OP(row, 2)), 12.);
+
+  // Scaled views can be the source of algorithms.
+  std::vector<double> out(12);
+  Kokkos::mdspan<double, Kokkos::extents<int, 3, dyn>, Kokkos::layout_left> b(out.data(), 4);
+  KokkosEx::copy(sa, b);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 4; ++j)
+      ASSERT_EQ((__MDSPAN_OP(b, i, j)), 2. * (__MDSPAN_OP(a, i, j)));
+}
+
+TEST(TestAccessorViews, conjugated) {
+  using cplx = std::complex<float>;
+  std::vector<cplx> data{{1.f, 2.f}, {3.f, -4.f}};
+  Kokkos::mdspan<cplx, Kokkos::dextents<int, 1>> a(data.data(), 2);
+
+  auto ca = KokkosEx::conjugated(a);
+  static_assert(std::is_same_v<decltype(ca)::element_type, const cplx>);
+  ASSERT_EQ((__MDSPAN_OP(ca, 0)), cplx(1.f, -2.f));
+  ASSERT_EQ((__MDSPAN_OP(ca, 1)), cplx(3.f, 4.f));
+
+  // Conjugating twice gives back the original accessor.
+  auto cca = KokkosEx::conjugated(ca);
+  static_assert(std::is_same_v<decltype(cca), decltype(a)>);
+
+  // Real element types are left unchanged.
+  std::vector<double> real{1., -2.};
+  auto cr = KokkosEx::conjugated(Kokkos::mdspan<double, Kokkos::dextents<int, 1>>(real.data(), 2));
+  static_assert(std::is_same_v<decltype(cr)::element_type, const double>);
+  ASSERT_EQ((__MDSPAN_OP(cr, 1)), -2.);
+
+  auto sc = KokkosEx::scaled(cplx(0.f, 1.f), ca);
+  ASSERT_EQ((__MDSPAN_OP(sc, 0)), cplx(2.f, 1.f));
+}
+
+TEST(TestAccessorViews, converted) {
+  std::vector<double> data{0.5, 1.25, 1e300, -3.};
+  Kokkos::mdspan<double, Kokkos::extents<int, 2, 2>> a(data.data());
+
+  auto fa = KokkosEx::converted<float>(a);
+  static_assert(std::is_same_v<decltype(fa)::element_type, const float>);
+  static_assert(std::is_same_v<decltype(fa)::reference, float>);
+  ASSERT_EQ((__MDSPAN_OP(fa, 0, 1)), 1.25f);
+
+  auto ia = KokkosEx::converted<int>(KokkosEx::submdspan(a, 1, Kokkos::full_extent));
+  ASSERT_EQ((__MDSPAN_OP(ia, 1)), -3);
+
+  // Conversions compose with the other views.
+  auto sfa = KokkosEx::scaled(2.f, fa);
+  static_assert(std::is_same_v<decltype(sfa)::reference, float>);
+  ASSERT_EQ((__MDSPAN_OP(sfa, 0, 0)), 1.f);
+}
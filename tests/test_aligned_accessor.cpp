@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template <size_t ByteAlignment>
+using aligned_float = KokkosEx::aligned_accessor<float, ByteAlignment>;
+
+TEST(TestAlignedAccessor, access) {
+  alignas(64) float data[32];
+  for (int i = 0; i < 32; ++i)
+    data[i] = i;
+  ASSERT_TRUE(KokkosEx::is_sufficiently_aligned<64>(data));
+  ASSERT_FALSE(KokkosEx::is_sufficiently_aligned<64>(data + 1));
+
+  Kokkos::mdspan<float, Kokkos::extents<int, 2, 16>, Kokkos::layout_right, aligned_float<64>> m(data);
+  ASSERT_EQ((__MDSPAN_OP(m, 1, 3)), 19.f);
+  __MDSPAN_OP(m, 0, 5) = -1.f;
+  ASSERT_EQ(data[5], -1.f);
+}
+
+TEST(TestAlignedAccessor, conversions) {
+  static_assert(std::is_convertible_v<aligned_float<64>, aligned_float<16>>);
+  static_assert(!std::is_constructible_v<aligned_float<64>, aligned_float<16>>);
+  static_assert(std::is_convertible_v<aligned_float<64>, KokkosEx::aligned_accessor<const float, 64>>);
+  static_assert(!std::is_constructible_v<aligned_float<64>, KokkosEx::aligned_accessor<const float, 64>>);
+  static_assert(std::is_convertible_v<aligned_float<64>, Kokkos::default_accessor<float>>);
+  static_assert(std::is_constructible_v<aligned_float<64>, Kokkos::default_accessor<float>>);
+  static_assert(!std::is_convertible_v<Kokkos::default_accessor<float>, aligned_float<64>>);
+
+  alignas(64) float data[16] = {};
+  Kokkos::mdspan<float, Kokkos::dextents<int, 1>, Kokkos::layout_right, aligned_float<64>> a(data, 16);
+  Kokkos::mdspan<const float, Kokkos::dextents<int, 1>> b = a;
+  ASSERT_EQ(b.data_handle(), data);
+}
+
+TEST(TestAlignedAccessor, submdspan_keeps_alignment) {
+  alignas(64) float data[8 * 16] = {};
+  Kokkos::mdspan<float, Kokkos::extents<int, dyn, 16>, Kokkos::layout_right, aligned_float<64>> m(data, 8);
+
+  auto all = KokkosEx::submdspan(m, Kokkos::full_extent, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(all)::accessor_type, aligned_float<64>>);
+
+  // Rows start every 16 floats.
+  auto row = KokkosEx::submdspan(m, 3, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(row)::accessor_type, aligned_float<64>>);
+  ASSERT_EQ(row.data_handle(), data + 48);
+
+  // Columns starting at a multiple of four floats.
+  using four = std::integral_constant<int, 4>;
+  using eight = std::integral_constant<int, 8>;
+  auto quad = KokkosEx::submdspan(m, std::pair{2, 4}, std::tuple<four, eight>{});
+  static_assert(std::is_same_v<decltype(quad)::accessor_type, aligned_float<16>>);
+  ASSERT_EQ(quad.data_handle(), data + 36);
+
+  // A runtime column offset breaks the alignment.
+  auto cols = KokkosEx::submdspan(m, Kokkos::full_extent, std::pair{1, 5});
+  static_assert(std::is_same_v<decltype(cols)::accessor_type, Kokkos::default_accessor<float>>);
+
+  // Dynamic row length: nothing is known about the row offsets.
+  Kokkos::mdspan<float, Kokkos::dextents<int, 2>, Kokkos::layout_right, aligned_float<64>> d(data, 8, 16);
+  auto drow = KokkosEx::submdspan(d, 3, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(drow)::accessor_type, Kokkos::default_accessor<float>>);
+
+  // ... unless the padding provides it.
+  using padded_t = KokkosEx::layout_left_padded<16>;
+  Kokkos::mdspan<float, Kokkos::dextents<int, 2>, padded_t, aligned_float<64>> p(
+      data, padded_t::mapping<Kokkos::dextents<int, 2>>(Kokkos::dextents<int, 2>(13, 4)));
+  auto column = KokkosEx::submdspan(p, Kokkos::full_extent, 2);
+  static_assert(std::is_same_v<decltype(column)::accessor_type, aligned_float<64>>);
+  ASSERT_EQ(column.data_handle(), data + 32);
+
+  // Layouts that are not strided: a static index says nothing about the
+  // offset. Row 4 of 3x5 blocks starts at block (1, 0), 35 floats in.
+  using blocked_t = KokkosEx::layout_blocked<3, 5>;
+  Kokkos::mdspan<float, Kokkos::extents<int, 9, 10>, blocked_t, aligned_float<16>> b(data);
+  auto brow = KokkosEx::submdspan(b, std::integral_constant<int, 4>{},
+      std::pair{std::integral_constant<int, 0>{}, std::integral_constant<int, 5>{}});
+  static_assert(std::is_same_v<decltype(brow)::accessor_type, Kokkos::default_accessor<float>>);
+  ASSERT_EQ(brow.data_handle(), data + 35);
+}
+
+TEST(TestAlignedAccessor, aligned_mdarray) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::aligned_mdarray<double, ext_t, 128> a(ext_t(5, 7));
+  ASSERT_TRUE(KokkosEx::is_sufficiently_aligned<128>(a.data()));
+  for (int i = 0; i < 5; ++i)
+    for (int j = 0; j < 7; ++j)
+      __MDSPAN_OP(a, i, j) = i * 7 + j;
+
+  auto v = KokkosEx::to_aligned_mdspan(a);
+  static_assert(std::is_same_v<decltype(v)::accessor_type, KokkosEx::aligned_accessor<double, 128>>);
+  ASSERT_EQ((__MDSPAN_OP(v, 4, 6)), 34.);
+
+  const auto &ca = a;
+  auto cv = KokkosEx::to_aligned_mdspan(ca);
+  static_assert(std::is_same_v<decltype(cv)::element_type, const double>);
+  ASSERT_EQ((__MDSPAN_OP(cv, 2, 3)), 17.);
+}
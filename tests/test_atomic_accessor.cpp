@@ -0,0 +1,85 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+template <class T, class Accessor = KokkosEx::atomic_accessor<T>>
+using atomic_mdspan = Kokkos::mdspan<T, Kokkos::dextents<int, 3>, Kokkos::layout_right, Accessor>;
+
+TEST(TestAtomicAccessor, reference) {
+  std::vector<double> data(2 * 3 * 4, 0.);
+  atomic_mdspan<double> m(data.data(), 2, 3, 4);
+  static_assert(std::is_same_v<decltype(m)::reference, KokkosEx::atomic_ref_bounded<double, std::memory_order_seq_cst>>);
+
+  __MDSPAN_OP(m, 1, 2, 3) = 1.5;
+  ASSERT_EQ(data[23], 1.5);
+  ASSERT_EQ((__MDSPAN_OP(m, 1, 2, 3)) += 2., 3.5);
+  ASSERT_EQ((__MDSPAN_OP(m, 1, 2, 3)).fetch_sub(0.5), 3.5);
+  ASSERT_EQ(double(__MDSPAN_OP(m, 1, 2, 3)), 3.);
+  ASSERT_EQ((__MDSPAN_OP(m, 1, 2, 3)).exchange(7.), 3.);
+  double expected = 1.;
+  ASSERT_FALSE((__MDSPAN_OP(m, 1, 2, 3)).compare_exchange_weak(expected, 2.));
+  ASSERT_EQ(expected, 7.);
+  ASSERT_EQ(KokkosEx::atomic_fetch_add_relaxed(__MDSPAN_OP(m, 0, 0, 1), 4.), 0.);
+  ASSERT_EQ(data[1], 4.);
+
+  std::vector<int> idata(2 * 3 * 4, 0);
+  atomic_mdspan<int, KokkosEx::atomic_accessor_relaxed<int>> mi(idata.data(), 2, 3, 4);
+  ++__MDSPAN_OP(mi, 0, 1, 0);
+  ASSERT_EQ((__MDSPAN_OP(mi, 0, 1, 0))++, 1);
+  ASSERT_EQ(idata[4], 2);
+
+  // Conversion from a non-atomic mdspan.
+  Kokkos::mdspan<int, Kokkos::dextents<int, 3>> plain(idata.data(), 2, 3, 4);
+  atomic_mdspan<int> from_plain = plain;
+  ASSERT_EQ(int(__MDSPAN_OP(from_plain, 0, 1, 0)), 2);
+}
+
+TEST(TestAtomicAccessor, concurrent_scatter_add) {
+  constexpr int num_threads = 4;
+  constexpr int num_updates = 10000;
+  std::vector<double> grid(4 * 4 * 4, 0.);
+  std::vector<long> counts(4 * 4 * 4, 0);
+  atomic_mdspan<double, KokkosEx::atomic_accessor_relaxed<double>> g(grid.data(), 4, 4, 4);
+  atomic_mdspan<long, KokkosEx::atomic_accessor_relaxed<long>> c(counts.data(), 4, 4, 4);
+
+  std::vector<std::thread> threads;
+  for(int t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      for(int n = 0; n < num_updates; ++n) {
+        int i = n % 4, j = (n / 4) % 4, k = (n / 16) % 4;
+        KokkosEx::atomic_fetch_add_relaxed(__MDSPAN_OP(g, i, j, k), 0.5);
+        ++__MDSPAN_OP(c, i, j, k);
+      }
+    });
+  }
+  for(auto& t : threads) t.join();
+
+  double total = 0.;
+  long total_count = 0;
+  for(size_t n = 0; n < grid.size(); ++n) {
+    total += grid[n];
+    total_count += counts[n];
+  }
+  ASSERT_EQ(total, 0.5 * num_threads * num_updates);
+  ASSERT_EQ(total_count, long(num_threads) * num_updates);
+}
@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+// Offsets of map, last index fastest.
+template <class Mapping>
+std::vector<int> offsets_right(const Mapping& map) {
+  std::vector<int> result;
+  const auto& e = map.extents();
+  for (int i = 0; i < e.extent(0); ++i)
+    for (int j = 0; j < e.extent(1); ++j)
+      for (int k = 0; k < e.extent(2); ++k)
+        result.push_back(map(i, j, k));
+  return result;
+}
+
+template <class Mapping>
+void check_coalesced(const Mapping& map, std::array<int, 3> exts, std::array<int, 3> strides) {
+  auto c = KokkosEx::coalesce_dimensions(map);
+  static_assert(std::is_same<decltype(c), Kokkos::layout_stride::mapping<Kokkos::dextents<int, 3>>>::value, "");
+  for (int r = 0; r < 3; ++r) {
+    ASSERT_EQ(c.extents().extent(r), exts[r]) << r;
+    if (exts[r] != 1) {
+      ASSERT_EQ(c.stride(r), strides[r]) << r;
+    }
+  }
+  ASSERT_EQ(offsets_right(c), offsets_right(map));
+  ASSERT_EQ(c.required_span_size(), map.required_span_size());
+}
+
+TEST(TestCoalesceDimensions, exhaustive) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(3, 4, 5), std::array<int, 3>{20, 5, 1}),
+                  {1, 1, 60}, {0, 0, 1});
+  check_coalesced(Kokkos::layout_right::mapping<ext_t>(ext_t(3, 4, 5)), {1, 1, 60}, {0, 0, 1});
+  // Column major: no dimension is contiguous with the next one.
+  check_coalesced(Kokkos::layout_left::mapping<ext_t>(ext_t(3, 4, 5)), {3, 4, 5}, {1, 3, 12});
+}
+
+TEST(TestCoalesceDimensions, padded) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  // Rows padded to 8: the outer two dimensions merge, the inner one doesn't.
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(3, 4, 5), std::array<int, 3>{32, 8, 1}),
+                  {1, 12, 5}, {0, 8, 1});
+  // Planes padded: the inner two dimensions merge.
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(3, 4, 5), std::array<int, 3>{24, 5, 1}),
+                  {1, 3, 20}, {0, 24, 1});
+  // Strided innermost dimension still merges with the outer ones.
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(3, 4, 5), std::array<int, 3>{40, 10, 2}),
+                  {1, 1, 60}, {0, 0, 2});
+}
+
+TEST(TestCoalesceDimensions, unit_extents) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  // The middle dimension has extent 1 and an unrelated stride.
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(6, 1, 7), std::array<int, 3>{7, 100, 1}),
+                  {1, 1, 42}, {0, 0, 1});
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(1, 1, 1), std::array<int, 3>{1, 1, 1}),
+                  {1, 1, 1}, {0, 0, 0});
+  // Empty: merged into an empty inner dimension.
+  check_coalesced(Kokkos::layout_stride::mapping<ext_t>(ext_t(3, 0, 5), std::array<int, 3>{5, 5, 1}),
+                  {1, 3, 0}, {0, 5, 1});
+}
+
+TEST(TestCoalesceDimensions, submdspan) {
+  // submdspan(x, i, full_extent, full_extent) of an exhaustive layout_stride x
+  // is a single run of memory.
+  using ext_t = Kokkos::dextents<int, 3>;
+  std::vector<int> data(6 * 7 * 8);
+  Kokkos::layout_stride::mapping<ext_t> map(ext_t(6, 7, 8), std::array<int, 3>{56, 8, 1});
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> x(data.data(), map);
+  auto sub = KokkosEx::submdspan(x, 2, Kokkos::full_extent, Kokkos::full_extent);
+  auto c = KokkosEx::coalesce_dimensions(sub.mapping());
+  static_assert(decltype(c)::extents_type::rank() == 2, "");
+  ASSERT_EQ(c.extents().extent(0), 1);
+  ASSERT_EQ(c.extents().extent(1), 56);
+  ASSERT_EQ(c.stride(1), 1);
+  Kokkos::mdspan<int, Kokkos::dextents<int, 2>, Kokkos::layout_stride> flat(sub.data_handle(), c);
+  ASSERT_EQ((&__MDSPAN_OP(flat, 0, 0)), (&__MDSPAN_OP(x, 2, 0, 0)));
+  ASSERT_EQ((&__MDSPAN_OP(flat, 0, 55)), (&__MDSPAN_OP(x, 2, 6, 7)));
+}
+
+TEST(TestCoalesceDimensions, rank_0_and_1) {
+  auto c0 = KokkosEx::coalesce_dimensions(Kokkos::layout_right::mapping<Kokkos::extents<int>>());
+  ASSERT_EQ(c0(), 0);
+  using ext_t = Kokkos::dextents<int, 1>;
+  auto c1 = KokkosEx::coalesce_dimensions(
+    Kokkos::layout_stride::mapping<ext_t>(ext_t(9), std::array<int, 1>{3}));
+  ASSERT_EQ(c1.extents().extent(0), 9);
+  ASSERT_EQ(c1.stride(0), 3);
+}
+
+// The algorithms merge contiguous levels of their loop nests the same way.
+TEST(TestCoalesceDimensions, algorithms) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  // Rows of 5 padded to 8, so that only the outer two dimensions merge.
+  Kokkos::layout_stride::mapping<ext_t> map(ext_t(3, 4, 5), std::array<int, 3>{32, 8, 1});
+  std::vector<int> a(96, -1), b(96, -1), c(96, -1);
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> sa(a.data(), map), sb(b.data(), map), sc(c.data(), map);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      for (int k = 0; k < 5; ++k)
+        __MDSPAN_OP(sa, i, j, k) = (i * 4 + j) * 5 + k;
+  KokkosEx::copy(sa, sb);
+  KokkosEx::transform(sa, sb, sc, [](int x, int y) { return x + y; });
+  for (int n = 0; n < 96; ++n) {
+    ASSERT_EQ(b[n], a[n]) << n;
+    ASSERT_EQ(c[n], a[n] < 0 ? -1 : 2 * a[n]) << n;
+  }
+  ASSERT_EQ(KokkosEx::reduce(sa, 0, [](int x, int y) { return x + y; }), 59 * 60 / 2);
+}
@@ -0,0 +1,149 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/algorithm.hpp>
+#include <vector>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Accessor the copy kernels can not bypass, exercising the generic path.
+template<class ElementType>
+struct counting_accessor {
+  using offset_policy = counting_accessor;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  MDSPAN_INLINE_FUNCTION constexpr counting_accessor() noexcept = default;
+
+  reference access(data_handle_type p, size_t i) const noexcept {
+    ++(*count);
+    return p[i];
+  }
+  data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+
+  int* count = nullptr;
+};
+
+template<class MDSpan>
+void iota_fill(MDSpan s) {
+  int v = 0;
+  if constexpr (MDSpan::rank() == 2) {
+    for(int i = 0; i < s.extent(0); ++i)
+      for(int j = 0; j < s.extent(1); ++j)
+        __MDSPAN_OP(s, i, j) = v++;
+  } else {
+    for(int i = 0; i < s.extent(0); ++i)
+      for(int j = 0; j < s.extent(1); ++j)
+        for(int k = 0; k < s.extent(2); ++k)
+          __MDSPAN_OP(s, i, j, k) = v++;
+  }
+}
+
+template<class MDSpanA, class MDSpanB>
+void check_equal(MDSpanA a, MDSpanB b) {
+  ASSERT_EQ(a.extents(), b.extents());
+  if constexpr (MDSpanA::rank() == 2) {
+    for(int i = 0; i < a.extent(0); ++i)
+      for(int j = 0; j < a.extent(1); ++j)
+        ASSERT_EQ((__MDSPAN_OP(a, i, j)), (__MDSPAN_OP(b, i, j)));
+  } else {
+    for(int i = 0; i < a.extent(0); ++i)
+      for(int j = 0; j < a.extent(1); ++j)
+        for(int k = 0; k < a.extent(2); ++k)
+          ASSERT_EQ((__MDSPAN_OP(a, i, j, k)), (__MDSPAN_OP(b, i, j, k)));
+  }
+}
+
+template<class LayoutSrc, class LayoutDst, class Extents, class... Dyn>
+void test_copy_layouts(Dyn... dyn_exts) {
+  Extents exts(dyn_exts...);
+  std::vector<int> a(Kokkos::layout_right::mapping<Extents>(exts).required_span_size(), -1);
+  std::vector<int> b(a.size(), -1);
+  Kokkos::mdspan<int, Extents, LayoutSrc> src(a.data(), exts);
+  Kokkos::mdspan<int, Extents, LayoutDst> dst(b.data(), exts);
+  iota_fill(src);
+  KokkosEx::copy(src, dst);
+  check_equal(src, dst);
+}
+
+TEST(TestCopy, same_layout) {
+  test_copy_layouts<Kokkos::layout_right, Kokkos::layout_right, Kokkos::dextents<int, 2>>(7, 5);
+  test_copy_layouts<Kokkos::layout_left, Kokkos::layout_left, Kokkos::extents<int, 3, dyn, 4>>(5);
+}
+
+TEST(TestCopy, transpose) {
+  // Extents larger than the tile size to cover partial tiles.
+  test_copy_layouts<Kokkos::layout_left, Kokkos::layout_right, Kokkos::dextents<int, 2>>(70, 45);
+  test_copy_layouts<Kokkos::layout_right, Kokkos::layout_left, Kokkos::dextents<int, 2>>(33, 65);
+  test_copy_layouts<Kokkos::layout_left, Kokkos::layout_right, Kokkos::dextents<int, 3>>(3, 40, 35);
+  test_copy_layouts<Kokkos::layout_right, Kokkos::layout_left, Kokkos::extents<int, 35, dyn, 4>>(6);
+}
+
+TEST(TestCopy, layout_stride) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  std::vector<int> a(40 * 50);
+  std::vector<int> b(40 * 50);
+  Kokkos::mdspan<int, ext_t> src(a.data(), 40, 50);
+  iota_fill(src);
+
+  // Every other column of src into a transposed layout_stride destination.
+  auto sub = KokkosEx::submdspan(src, Kokkos::full_extent, KokkosEx::strided_slice<int, int, int>{1, 48, 2});
+  Kokkos::layout_stride::mapping<ext_t> map(sub.extents(), std::array<int, 2>{1, 40});
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> dst(b.data(), map);
+  KokkosEx::copy(sub, dst);
+  check_equal(sub, dst);
+
+  // Exhaustive layout_stride on both sides.
+  Kokkos::layout_stride::mapping<ext_t> map_right(ext_t(40, 50), std::array<int, 2>{50, 1});
+  std::vector<int> c(40 * 50);
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> src_stride(a.data(), map_right);
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_stride> dst_stride(c.data(), map_right);
+  KokkosEx::copy(src_stride, dst_stride);
+  ASSERT_EQ(a, c);
+}
+
+TEST(TestCopy, converting) {
+  std::vector<int> a(12);
+  std::vector<double> b(12);
+  Kokkos::mdspan<int, Kokkos::extents<int, 3, 4>> src(a.data());
+  Kokkos::mdspan<double, Kokkos::extents<int, 3, 4>, Kokkos::layout_left> dst(b.data());
+  iota_fill(src);
+  KokkosEx::copy(Kokkos::mdspan<const int, Kokkos::extents<int, 3, 4>>(src), dst);
+  check_equal(src, dst);
+}
+
+TEST(TestCopy, generic_accessor) {
+  std::vector<int> a(24);
+  std::vector<int> b(24);
+  int count = 0;
+  counting_accessor<int> acc;
+  acc.count = &count;
+  Kokkos::mdspan<int, Kokkos::extents<int, 2, 3, 4>> src(a.data());
+  Kokkos::mdspan<int, Kokkos::extents<int, 2, 3, 4>, Kokkos::layout_left, counting_accessor<int>>
+    dst(b.data(), Kokkos::layout_left::mapping<Kokkos::extents<int, 2, 3, 4>>(), acc);
+  iota_fill(src);
+  KokkosEx::copy(src, dst);
+  ASSERT_EQ(count, 24);
+  check_equal(src, Kokkos::mdspan<int, Kokkos::extents<int, 2, 3, 4>, Kokkos::layout_left>(b.data()));
+}
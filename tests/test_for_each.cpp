@@ -0,0 +1,226 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Accessor the traversal can not bypass, exercising the generic path.
+template<class ElementType>
+struct counting_accessor {
+  using offset_policy = counting_accessor;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  MDSPAN_INLINE_FUNCTION constexpr counting_accessor() noexcept = default;
+
+  reference access(data_handle_type p, size_t i) const noexcept {
+    ++(*count);
+    return p[i];
+  }
+  data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+
+  int* count = nullptr;
+};
+
+// Visits every index once with the offset of the mapping, in increasing
+// offset order for exhaustive mappings.
+template<class Mapping>
+void test_for_each_index(const Mapping& map) {
+  std::vector<int> visits(map.required_span_size(), 0);
+  int last = -1;
+  bool increasing = true;
+  size_t count = 0;
+  KokkosEx::for_each_index(map, [&](int offset, int i, int j, int k) {
+    ASSERT_EQ(offset, map(i, j, k));
+    ++visits[offset];
+    increasing = increasing && offset > last;
+    last = offset;
+    ++count;
+  });
+  ASSERT_EQ(count, size_t(map.extents().extent(0)) * map.extents().extent(1) * map.extents().extent(2));
+  for(size_t n = 0; n < visits.size(); ++n)
+    ASSERT_LE(visits[n], 1);
+  if(map.is_exhaustive()) {
+    ASSERT_TRUE(increasing);
+  }
+}
+
+TEST(TestForEachIndex, layouts) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  test_for_each_index(Kokkos::layout_right::mapping<ext_t>(ext_t(3, 4, 5)));
+  test_for_each_index(Kokkos::layout_left::mapping<ext_t>(ext_t(3, 4, 5)));
+  test_for_each_index(Kokkos::layout_right::mapping<Kokkos::extents<int, 2, dyn, 3>>(
+    Kokkos::extents<int, 2, dyn, 3>(4)));
+  // Dimension 1 has the largest stride, dimension 2 is padded.
+  test_for_each_index(Kokkos::layout_stride::mapping<ext_t>(
+    ext_t(3, 4, 5), std::array<int, 3>{6, 18, 1}));
+  test_for_each_index(KokkosEx::layout_blocked<2, 2, 2>::mapping<ext_t>(ext_t(3, 4, 5)));
+  test_for_each_index(Kokkos::layout_right::mapping<ext_t>(ext_t(3, 0, 5)));
+}
+
+// layout_stride mapping whose dimensions are nested in the order perm, from
+// the largest stride to the smallest, without gaps.
+template<size_t Rank>
+Kokkos::layout_stride::mapping<Kokkos::dextents<int, Rank>>
+permuted_mapping(const std::array<int, Rank>& exts, const std::array<size_t, Rank>& perm) {
+  std::array<int, Rank> strides{};
+  int stride = 1;
+  for(size_t l = Rank; l-- > 0;) {
+    strides[perm[l]] = stride;
+    stride *= exts[perm[l]];
+  }
+  return {Kokkos::dextents<int, Rank>(exts), strides};
+}
+
+// Every permutation of the dimensions is walked in memory order.
+template<size_t Rank>
+void test_for_each_index_permutations(const std::array<int, Rank>& exts) {
+  std::array<size_t, Rank> perm;
+  std::iota(perm.begin(), perm.end(), size_t(0));
+  do {
+    auto map = permuted_mapping(exts, perm);
+    int expected = 0;
+    KokkosEx::for_each_index(map, [&](int offset, auto... idx) {
+      ASSERT_EQ(offset, map(idx...));
+      ASSERT_EQ(offset, expected++);
+    });
+    ASSERT_EQ(size_t(expected), map.required_span_size());
+  } while(std::next_permutation(perm.begin(), perm.end()));
+}
+
+TEST(TestForEachIndex, permutations) {
+  test_for_each_index_permutations(std::array<int, 1>{7});
+  test_for_each_index_permutations(std::array<int, 2>{3, 5});
+  test_for_each_index_permutations(std::array<int, 3>{2, 3, 4});
+  test_for_each_index_permutations(std::array<int, 4>{2, 3, 4, 5});
+  // Above the ranks with a kernel per permutation.
+  test_for_each_index_permutations(std::array<int, 5>{2, 1, 3, 2, 3});
+}
+
+TEST(TestForEachIndex, submdspan) {
+  // Every other column of a column major array, as layout_stride.
+  using ext_t = Kokkos::dextents<int, 3>;
+  std::vector<int> data(4 * 6 * 3);
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_left> s(data.data(), 4, 6, 3);
+  auto sub = KokkosEx::submdspan(s, Kokkos::full_extent,
+                                 KokkosEx::strided_slice<int, int, int>{0, 6, 2},
+                                 std::pair<int, int>(1, 3));
+  static_assert(std::is_same<typename decltype(sub)::layout_type, Kokkos::layout_stride>::value, "");
+  test_for_each_index(sub.mapping());
+  int last = -1;
+  KokkosEx::for_each_index(sub.mapping(), [&](int offset, int, int, int) {
+    ASSERT_GT(offset, last);
+    last = offset;
+  });
+}
+
+TEST(TestForEachIndex, rank_0) {
+  int calls = 0;
+  KokkosEx::for_each_index(Kokkos::layout_right::mapping<Kokkos::extents<int>>(), [&](int offset) {
+    ASSERT_EQ(offset, 0);
+    ++calls;
+  });
+  ASSERT_EQ(calls, 1);
+}
+
+template<class Layout>
+void test_for_each_layout(typename Layout::template mapping<Kokkos::dextents<int, 3>> map) {
+  std::vector<int> data(map.required_span_size(), -1);
+  Kokkos::mdspan<int, Kokkos::dextents<int, 3>, Layout> s(data.data(), map);
+  int v = 0;
+  KokkosEx::for_each(s, [&](int& x) { x = v++; });
+  ASSERT_EQ(size_t(v), s.size());
+  // Visited in memory order.
+  int expected = 0;
+  for(size_t n = 0; n < data.size(); ++n)
+    if(data[n] >= 0) {
+      ASSERT_EQ(data[n], expected++);
+    }
+  ASSERT_EQ(expected, v);
+}
+
+TEST(TestForEach, layouts) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  const ext_t exts(3, 4, 5);
+  test_for_each_layout<Kokkos::layout_right>(Kokkos::layout_right::mapping<ext_t>(exts));
+  test_for_each_layout<Kokkos::layout_left>(Kokkos::layout_left::mapping<ext_t>(exts));
+  // Padded innermost dimension: the two outer dimensions collapse.
+  test_for_each_layout<Kokkos::layout_stride>(
+    Kokkos::layout_stride::mapping<ext_t>(exts, std::array<int, 3>{32, 8, 1}));
+  test_for_each_layout<Kokkos::layout_stride>(
+    Kokkos::layout_stride::mapping<ext_t>(exts, std::array<int, 3>{2, 6, 24}));
+}
+
+TEST(TestForEach, submdspan) {
+  std::vector<int> data(6 * 7, 0);
+  Kokkos::mdspan<int, Kokkos::dextents<int, 2>> s(data.data(), 6, 7);
+  auto sub = KokkosEx::submdspan(s, std::pair<int, int>(1, 5), std::pair<int, int>(2, 4));
+  KokkosEx::for_each(sub, [](int& x) { x += 1; });
+  for(int i = 0; i < 6; ++i)
+    for(int j = 0; j < 7; ++j)
+      ASSERT_EQ((__MDSPAN_OP(s, i, j)), (i >= 1 && i < 5 && j >= 2 && j < 4) ? 1 : 0);
+}
+
+TEST(TestForEach, generic_accessor) {
+  std::vector<int> data(2 * 3 * 4, 1);
+  int count = 0;
+  counting_accessor<int> acc;
+  acc.count = &count;
+  using ext_t = Kokkos::extents<int, 2, 3, 4>;
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_right, counting_accessor<int>> s(
+    data.data(), Kokkos::layout_right::mapping<ext_t>(), acc);
+  long sum = 0;
+  KokkosEx::for_each(s, [&](int x) { sum += x; });
+  ASSERT_EQ(sum, 24);
+  ASSERT_EQ(count, 24);
+}
+
+TEST(TestForEach, rank_0) {
+  int x = 3;
+  Kokkos::mdspan<int, Kokkos::extents<int>> s(&x);
+  KokkosEx::for_each(s, [](int& y) { y *= 2; });
+  ASSERT_EQ(x, 6);
+}
+
+TEST(TestForEach, generic_accessor_memory_order) {
+  // Accessors without pointer access are also handed the elements in memory
+  // order, here of a column major array.
+  std::vector<int> data(3 * 4 * 5, -1);
+  int count = 0;
+  counting_accessor<int> acc;
+  acc.count = &count;
+  using ext_t = Kokkos::dextents<int, 3>;
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_left, counting_accessor<int>> s(
+    data.data(), Kokkos::layout_left::mapping<ext_t>(ext_t(3, 4, 5)), acc);
+  int v = 0;
+  KokkosEx::for_each(s, [&](int& x) { x = v++; });
+  ASSERT_EQ(count, 60);
+  for(size_t n = 0; n < data.size(); ++n)
+    ASSERT_EQ(data[n], int(n));
+}
@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <mdspan/algorithm.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+TEST(TestLayoutBanded, offsets) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  // Two sub- and one superdiagonal, LAPACK ldab = 4.
+  using map_t = KokkosEx::layout_banded<2, 1>::mapping<ext_t>;
+  map_t map(ext_t(6, 5));
+  ASSERT_EQ(map.ldab(), 4);
+  ASSERT_EQ(map.required_span_size(), 4 * 5 + 1);
+  ASSERT_FALSE(map.is_unique());
+  ASSERT_FALSE(map.is_exhaustive());
+  std::vector<int> hits(map.required_span_size(), 0);
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 5; ++j) {
+      const bool band = i - j <= 2 && j - i <= 1;
+      ASSERT_EQ(map.in_band(i, j), band);
+      if (band) {
+        ASSERT_EQ(map(i, j), 1 + i - j + j * 4);
+        ++hits[map(i, j)];
+      } else {
+        ASSERT_EQ(map(i, j), map.zero_offset());
+      }
+    }
+  for (int h : hits)
+    ASSERT_LE(h, 1);
+
+  ASSERT_EQ(map.nonzero_rows(0), std::make_pair(0, 3));
+  ASSERT_EQ(map.nonzero_rows(3), std::make_pair(2, 6));
+  ASSERT_EQ(map.nonzero_rows(4), std::make_pair(3, 6));
+  ASSERT_EQ(map.nonzero_columns(0), std::make_pair(0, 2));
+  ASSERT_EQ(map.nonzero_columns(5), std::make_pair(3, 5));
+}
+
+TEST(TestLayoutBanded, unsigned_index_type) {
+  using ext_t = Kokkos::dextents<size_t, 2>;
+  using map_t = KokkosEx::layout_banded<1, 1>::mapping<ext_t>;
+  map_t map(ext_t(4, 4));
+  for (size_t i = 0; i < 4; ++i)
+    for (size_t j = 0; j < 4; ++j) {
+      const bool band = i <= j + 1 && j <= i + 1;
+      ASSERT_EQ(map.in_band(i, j), band);
+      ASSERT_EQ(map(i, j), band ? 1 + i - j + j * 3 : map.zero_offset());
+    }
+
+  const size_t n = 6;
+  KokkosEx::mdarray<double, ext_t, KokkosEx::layout_banded<1, 1>> a(ext_t(n, n));
+  for (auto &v : a.container())
+    v = 0.;
+  for (size_t i = 0; i < n; ++i)
+    for (size_t j = 0; j < n; ++j)
+      if (a.mapping().in_band(i, j))
+        __MDSPAN_OP(a, i, j) = i == j ? 2. : -1.;
+  std::vector<double> x(n, 1.), y(n);
+  KokkosEx::banded_matrix_vector_product(a.to_mdspan(), Kokkos::mdspan<const double, Kokkos::dextents<size_t, 1>>(x.data(), n),
+                                         Kokkos::mdspan<double, Kokkos::dextents<size_t, 1>>(y.data(), n));
+  for (size_t i = 0; i < n; ++i)
+    ASSERT_DOUBLE_EQ(y[i], i == 0 || i == n - 1 ? 1. : 0.);
+}
+
+TEST(TestLayoutBanded, properties) {
+  using diag_t = KokkosEx::layout_banded<0, 0>::mapping<Kokkos::extents<int, 4, 4>>;
+  static_assert(std::is_empty_v<diag_t>);
+  static_assert(!diag_t::is_always_unique());
+  ASSERT_EQ(diag_t().required_span_size(), 5);
+  // Diagonal: every band element and the zero element are used.
+  ASSERT_TRUE(diag_t().is_exhaustive());
+
+  using full_t = KokkosEx::layout_banded<2, 3>::mapping<Kokkos::extents<int, 3, 4>>;
+  static_assert(full_t::is_always_unique());
+  ASSERT_TRUE(full_t().is_unique());
+
+  using dyn_t = KokkosEx::layout_banded<0, 0>::mapping<Kokkos::dextents<int, 2>>;
+  dyn_t converted = diag_t();
+  ASSERT_EQ(converted.extents().extent(0), 4);
+  ASSERT_EQ(dyn_t(Kokkos::dextents<int, 2>(0, 3)).required_span_size(), 0);
+}
+
+TEST(TestLayoutBanded, tridiagonal_matvec) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  const int n = 9;
+  KokkosEx::mdarray<double, ext_t, KokkosEx::layout_banded<1, 1>> a(ext_t(n, n));
+  ASSERT_EQ(a.container().size(), size_t(3 * n + 1));
+  for (auto &v : a.container())
+    v = 0.;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      if (a.mapping().in_band(i, j))
+        __MDSPAN_OP(a, i, j) = i == j ? 2. : -1. - 0.1 * i;
+  // Reads off the band see the zero element.
+  ASSERT_EQ((__MDSPAN_OP(a, 0, 5)), 0.);
+
+  std::vector<double> x(n), y(n, -7.);
+  for (int i = 0; i < n; ++i)
+    x[i] = i + 1;
+  auto A = a.to_mdspan();
+  KokkosEx::banded_matrix_vector_product(A, Kokkos::mdspan<const double, Kokkos::dextents<int, 1>>(x.data(), n),
+                                         Kokkos::mdspan<double, Kokkos::dextents<int, 1>>(y.data(), n));
+  for (int i = 0; i < n; ++i) {
+    double expected = 0;
+    for (int j = 0; j < n; ++j)
+      expected += __MDSPAN_OP(A, i, j) * x[j];
+    ASSERT_DOUBLE_EQ(y[i], expected);
+  }
+
+  // Rectangular, strided output.
+  KokkosEx::mdarray<double, ext_t, KokkosEx::layout_banded<2, 0>> b(ext_t(5, 3));
+  for (auto &v : b.container())
+    v = 0.;
+  for (int j = 0; j < 3; ++j)
+    for (int i = j; i < 5 && i <= j + 2; ++i)
+      __MDSPAN_OP(b, i, j) = i + 10 * j;
+  double yb[10] = {};
+  Kokkos::layout_stride::mapping<Kokkos::dextents<int, 1>> stride2(Kokkos::dextents<int, 1>(5), std::array<int, 1>{2});
+  KokkosEx::banded_matrix_vector_product(b.to_mdspan(), Kokkos::mdspan<const double, Kokkos::dextents<int, 1>>(x.data(), 3),
+                                         Kokkos::mdspan<double, Kokkos::dextents<int, 1>, Kokkos::layout_stride>(yb, stride2));
+  for (int i = 0; i < 5; ++i) {
+    double expected = 0;
+    for (int j = 0; j < 3; ++j)
+      expected += __MDSPAN_OP(b, i, j) * x[j];
+    ASSERT_DOUBLE_EQ(yb[2 * i], expected);
+    ASSERT_EQ(yb[2 * i + 1], 0.);
+  }
+}
@@ -0,0 +1,105 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template <class Triangle, class StorageOrder>
+using packed_t = KokkosEx::layout_blas_packed<Triangle, StorageOrder>;
+
+// Reference: enumerate the stored triangle in storage order.
+template <class Triangle, class StorageOrder>
+std::vector<std::vector<int>> reference_offsets(int n) {
+  constexpr bool upper = std::is_same_v<Triangle, KokkosEx::upper_triangle_t>;
+  constexpr bool col_major = std::is_same_v<StorageOrder, KokkosEx::column_major_t>;
+  std::vector<std::vector<int>> offsets(n, std::vector<int>(n, -1));
+  int next = 0;
+  for (int outer = 0; outer < n; ++outer)
+    for (int inner = 0; inner < n; ++inner) {
+      const int i = col_major ? inner : outer;
+      const int j = col_major ? outer : inner;
+      if (upper ? i <= j : i >= j)
+        offsets[i][j] = offsets[j][i] = next++;
+    }
+  return offsets;
+}
+
+template <class Triangle, class StorageOrder>
+void check_offsets() {
+  using ext_t = Kokkos::dextents<int, 2>;
+  const int n = 7;
+  typename packed_t<Triangle, StorageOrder>::template mapping<ext_t> map(ext_t(n, n));
+  ASSERT_EQ(map.required_span_size(), n * (n + 1) / 2);
+  ASSERT_FALSE(map.is_unique());
+  ASSERT_TRUE(map.is_exhaustive());
+  const auto expected = reference_offsets<Triangle, StorageOrder>(n);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ASSERT_EQ(map(i, j), expected[i][j]);
+}
+
+TEST(TestLayoutBlasPacked, offsets) {
+  check_offsets<KokkosEx::upper_triangle_t, KokkosEx::column_major_t>();
+  check_offsets<KokkosEx::upper_triangle_t, KokkosEx::row_major_t>();
+  check_offsets<KokkosEx::lower_triangle_t, KokkosEx::column_major_t>();
+  check_offsets<KokkosEx::lower_triangle_t, KokkosEx::row_major_t>();
+}
+
+TEST(TestLayoutBlasPacked, properties) {
+  using layout = packed_t<KokkosEx::upper_triangle_t, KokkosEx::row_major_t>;
+  using map_4 = layout::mapping<Kokkos::extents<int, 4, 4>>;
+  using map_1 = layout::mapping<Kokkos::extents<int, 1, dyn>>;
+  static_assert(std::is_empty_v<map_4>);
+  static_assert(!map_4::is_always_unique());
+  static_assert(map_4::is_always_exhaustive());
+  static_assert(map_1::is_always_unique());
+  static_assert(map_1::is_always_strided());
+  ASSERT_EQ(map_4().required_span_size(), 10);
+
+  layout::mapping<Kokkos::dextents<int, 2>> converted = map_4();
+  ASSERT_EQ(converted, map_4());
+  ASSERT_EQ(converted(3, 1), map_4()(1, 3));
+
+  layout::mapping<Kokkos::dextents<int, 2>> empty(Kokkos::dextents<int, 2>(0, 0));
+  ASSERT_EQ(empty.required_span_size(), 0);
+}
+
+TEST(TestLayoutBlasPacked, symmetric_mdarray) {
+  using layout = packed_t<KokkosEx::lower_triangle_t, KokkosEx::column_major_t>;
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::mdarray<double, ext_t, layout> a(ext_t(5, 5));
+  ASSERT_EQ(a.container().size(), size_t(15));
+  for (int j = 0; j < 5; ++j)
+    for (int i = j; i < 5; ++i)
+      __MDSPAN_OP(a, i, j) = 10 * i + j;
+  // Reads of the other triangle see the mirror image.
+  ASSERT_EQ((__MDSPAN_OP(a, 1, 3)), 31.);
+  __MDSPAN_OP(a, 0, 4) = -1.;
+  ASSERT_EQ((__MDSPAN_OP(a, 4, 0)), -1.);
+
+  Kokkos::mdspan<const double, ext_t, layout> v = a.to_mdspan();
+  double trace = 0;
+  for (int i = 0; i < 5; ++i)
+    trace += __MDSPAN_OP(v, i, i);
+  ASSERT_EQ(trace, 110.);
+}
@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Reference: tiles in layout_right order, layout_right inside each tile.
+template <class Mapping>
+size_t reference_offset_2d(const Mapping &map, size_t i, size_t j, size_t t0, size_t t1) {
+  const size_t n1 = (map.extents().extent(1) + t1 - 1) / t1;
+  return ((i / t0) * n1 + j / t1) * t0 * t1 + (i % t0) * t1 + j % t1;
+}
+
+TEST(TestLayoutBlocked, offsets_2d) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  using map_t = KokkosEx::layout_blocked<4, 8>::mapping<ext_t>;
+  static_assert(std::is_empty_v<KokkosEx::layout_blocked<4, 8>::mapping<Kokkos::extents<int, 4, 8>>>);
+  map_t map(ext_t(10, 13));
+  ASSERT_EQ(map.tile_size(), 32);
+  ASSERT_EQ(map.required_span_size(), 3 * 2 * 32);
+  ASSERT_FALSE(map.is_exhaustive());
+  ASSERT_FALSE(map.is_strided());
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 13; ++j)
+      ASSERT_EQ(static_cast<size_t>(map(i, j)), reference_offset_2d(map, i, j, 4, 8));
+}
+
+TEST(TestLayoutBlocked, non_power_of_two_tiles) {
+  using ext_t = Kokkos::extents<size_t, 9, 10>;
+  using map_t = KokkosEx::layout_blocked<3, 5>::mapping<ext_t>;
+  static_assert(map_t::is_always_exhaustive());
+  map_t map;
+  ASSERT_EQ(map.required_span_size(), 90u);
+  std::vector<int> hits(map.required_span_size(), 0);
+  for (size_t i = 0; i < 9; ++i)
+    for (size_t j = 0; j < 10; ++j) {
+      ASSERT_EQ(map(i, j), reference_offset_2d(map, i, j, 3, 5));
+      ++hits[map(i, j)];
+    }
+  for (int h : hits)
+    ASSERT_EQ(h, 1);
+}
+
+TEST(TestLayoutBlocked, rank_3_is_unique) {
+  using ext_t = Kokkos::extents<int, 5, dyn, 7>;
+  KokkosEx::layout_blocked<2, 4, 4>::mapping<ext_t> map(ext_t(6));
+  ASSERT_EQ(map.required_span_size(), 3 * 2 * 2 * 32);
+  std::vector<int> hits(map.required_span_size(), 0);
+  for (int i = 0; i < 5; ++i)
+    for (int j = 0; j < 6; ++j)
+      for (int k = 0; k < 7; ++k)
+        ++hits[map(i, j, k)];
+  int total = 0;
+  for (int h : hits) {
+    ASSERT_LE(h, 1);
+    total += h;
+  }
+  ASSERT_EQ(total, 5 * 6 * 7);
+  // Elements of a tile are contiguous.
+  ASSERT_EQ(map(2, 4, 4) + 1, map(2, 4, 5));
+}
+
+TEST(TestLayoutBlocked, strided_cases) {
+  KokkosEx::layout_blocked<4, 8>::mapping<Kokkos::dextents<int, 2>> single(
+      Kokkos::dextents<int, 2>(3, 5));
+  ASSERT_TRUE(single.is_strided());
+  ASSERT_EQ(single.stride(0), 8);
+  ASSERT_EQ(single(2, 4), 2 * 8 + 4);
+
+  // Only the leading dimension spans several tiles: rows of 8.
+  KokkosEx::layout_blocked<4, 8>::mapping<Kokkos::dextents<int, 2>> column(
+      Kokkos::dextents<int, 2>(20, 8));
+  ASSERT_TRUE(column.is_strided());
+  ASSERT_TRUE(column.is_exhaustive());
+  for (int i = 0; i < 20; ++i)
+    ASSERT_EQ(column(i, 3), i * 8 + 3);
+
+  static_assert(KokkosEx::layout_blocked<4, 8>::mapping<Kokkos::extents<int, 4, 6>>::is_always_strided());
+}
+
+TEST(TestLayoutBlocked, submdspan_tile) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  using layout_t = KokkosEx::layout_blocked<4, 8>;
+  KokkosEx::mdarray<int, ext_t, layout_t> a(ext_t(10, 13));
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 13; ++j)
+      __MDSPAN_OP(a, i, j) = 100 * i + j;
+  auto m = a.to_mdspan();
+
+  // A whole tile with static extents is a dense layout_right view.
+  using four = std::integral_constant<int, 4>;
+  using eight = std::integral_constant<int, 8>;
+  auto tile = KokkosEx::submdspan(m, KokkosEx::strided_slice<int, four, std::integral_constant<int, 1>>{4, {}, {}},
+                                  KokkosEx::strided_slice<int, eight, std::integral_constant<int, 1>>{8, {}, {}});
+  static_assert(std::is_same_v<decltype(tile)::layout_type, Kokkos::layout_right>);
+  static_assert(decltype(tile)::static_extent(0) == 4 && decltype(tile)::static_extent(1) == 8);
+  ASSERT_EQ(tile.data_handle(), (&__MDSPAN_OP(m, 4, 8)));
+  ASSERT_EQ((__MDSPAN_OP(tile, 3, 4)), 100 * 7 + 12);
+
+  // Runtime tile bounds keep the row pitch of the tile.
+  auto edge = KokkosEx::submdspan(m, std::pair{8, 10}, std::pair{8, 13});
+  static_assert(std::is_same_v<decltype(edge)::layout_type, KokkosEx::layout_right_padded<8>>);
+  ASSERT_EQ(edge.extent(0), 2);
+  ASSERT_EQ(edge.extent(1), 5);
+  ASSERT_EQ(edge.stride(0), 8);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 5; ++j)
+      ASSERT_EQ((__MDSPAN_OP(edge, i, j)), 100 * (8 + i) + 8 + j);
+
+  // A row inside a tile is contiguous.
+  auto row = KokkosEx::submdspan(m, 5, std::pair{0, 8});
+  static_assert(std::is_same_v<decltype(row)::layout_type, Kokkos::layout_right>);
+  ASSERT_EQ((__MDSPAN_OP(row, 7)), 507);
+
+  // A column inside a tile is strided.
+  auto col = KokkosEx::submdspan(m, std::pair{4, 8}, 9);
+  static_assert(std::is_same_v<decltype(col)::layout_type, Kokkos::layout_stride>);
+  ASSERT_EQ(col.stride(0), 8);
+  ASSERT_EQ((__MDSPAN_OP(col, 2)), 609);
+
+  // Every other element of a row inside a tile is strided.
+  auto evens = KokkosEx::submdspan(m, 1, KokkosEx::strided_slice<int, int, int>{0, 4, 2});
+  static_assert(std::is_same_v<decltype(evens)::layout_type, Kokkos::layout_stride>);
+  ASSERT_EQ(evens.extent(0), 2);
+  ASSERT_EQ(evens.stride(0), 2);
+  ASSERT_EQ((__MDSPAN_OP(evens, 1)), 102);
+
+#if !defined(NDEBUG)
+  ASSERT_THROW(KokkosEx::submdspan(m, std::pair{2, 6}, 0), std::runtime_error);
+#endif
+}
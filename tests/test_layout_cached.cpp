@@ -0,0 +1,100 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template <class Layout>
+struct TestLayoutCached : public ::testing::Test {
+  using layout_type = Layout;
+};
+
+using cached_layouts = ::testing::Types<Kokkos::layout_left, Kokkos::layout_right>;
+TYPED_TEST_SUITE(TestLayoutCached, cached_layouts);
+
+TYPED_TEST(TestLayoutCached, offsets_match_base) {
+  using layout_t = typename TestFixture::layout_type;
+  using ext_t = Kokkos::dextents<int, 4>;
+  using map_t = typename KokkosEx::layout_cached<layout_t>::template mapping<ext_t>;
+  const ext_t exts(3, 4, 2, 5);
+  const map_t map(exts);
+  const typename layout_t::template mapping<ext_t> base(exts);
+  ASSERT_EQ(map.required_span_size(), base.required_span_size());
+  for (int r = 0; r < 4; ++r)
+    ASSERT_EQ(map.stride(r), base.stride(r));
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      for (int k = 0; k < 2; ++k)
+        for (int l = 0; l < 5; ++l)
+          ASSERT_EQ(map(i, j, k, l), base(i, j, k, l));
+  ASSERT_TRUE(map.base_mapping() == base);
+  ASSERT_TRUE(map == map_t(base));
+}
+
+TYPED_TEST(TestLayoutCached, properties) {
+  using layout_t = typename TestFixture::layout_type;
+  using static_t = typename KokkosEx::layout_cached<layout_t>::template mapping<Kokkos::extents<int, 2, 3>>;
+  using dyn_t = typename KokkosEx::layout_cached<layout_t>::template mapping<Kokkos::extents<int, dyn, 3>>;
+  static_assert(static_t::is_always_unique());
+  static_assert(static_t::is_always_exhaustive());
+  static_assert(static_t::is_always_strided());
+  static_assert(std::is_same_v<typename static_t::layout_type, KokkosEx::layout_cached<layout_t>>);
+
+  // A default constructed mapping has the strides of its static extents.
+  const static_t def;
+  ASSERT_EQ(def(1, 2), (typename layout_t::template mapping<Kokkos::extents<int, 2, 3>>()(1, 2)));
+
+  const dyn_t converted = def;
+  ASSERT_EQ(converted.extents().extent(0), 2);
+  ASSERT_EQ(converted.stride(0), def.stride(0));
+  ASSERT_EQ(converted.stride(1), def.stride(1));
+  ASSERT_TRUE(converted == def);
+
+  using rank0_t = typename KokkosEx::layout_cached<layout_t>::template mapping<Kokkos::extents<int>>;
+  ASSERT_EQ(rank0_t()(), 0);
+  ASSERT_EQ(rank0_t().required_span_size(), 1);
+
+  const Kokkos::layout_stride::mapping<Kokkos::dextents<int, 2>> strided(converted);
+  ASSERT_EQ(strided.stride(0), converted.stride(0));
+  ASSERT_EQ(strided.stride(1), converted.stride(1));
+}
+
+TYPED_TEST(TestLayoutCached, mdspan_and_submdspan) {
+  using layout_t = typename TestFixture::layout_type;
+  using ext_t = Kokkos::dextents<int, 3>;
+  std::vector<int> data(4 * 5 * 6);
+  for (size_t n = 0; n < data.size(); ++n)
+    data[n] = int(n);
+  Kokkos::mdspan<int, ext_t, KokkosEx::layout_cached<layout_t>> a(data.data(), 4, 5, 6);
+  Kokkos::mdspan<int, ext_t, layout_t> b(data.data(), 4, 5, 6);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j)
+      for (int k = 0; k < 6; ++k)
+        ASSERT_EQ((a.accessor().access(a.data_handle(), a.mapping()(i, j, k))),
+                  (b.accessor().access(b.data_handle(), b.mapping()(i, j, k))));
+
+  auto sa = KokkosEx::submdspan(a, 2, Kokkos::full_extent, std::pair<int, int>(1, 4));
+  auto sb = KokkosEx::submdspan(b, 2, Kokkos::full_extent, std::pair<int, int>(1, 4));
+  static_assert(std::is_same_v<decltype(sa), decltype(sb)>);
+  ASSERT_EQ(sa.data_handle(), sb.data_handle());
+  ASSERT_EQ(sa.mapping(), sb.mapping());
+}
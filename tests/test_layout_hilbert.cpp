@@ -0,0 +1,139 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Reference: the classic xy2d conversion on an n x n square, transposed for
+// an even number of levels so that the curve always starts along y.
+size_t reference_offset(size_t n, size_t x, size_t y) {
+  size_t levels = 0;
+  while ((size_t(1) << levels) < n)
+    ++levels;
+  if (levels % 2 == 0)
+    std::swap(x, y);
+  size_t d = 0;
+  for (size_t s = n / 2; s > 0; s /= 2) {
+    const size_t rx = (x & s) > 0;
+    const size_t ry = (y & s) > 0;
+    d += s * s * ((3 * rx) ^ ry);
+    if (ry == 0) {
+      if (rx == 1) {
+        x = n - 1 - x;
+        y = n - 1 - y;
+      }
+      std::swap(x, y);
+    }
+  }
+  return d;
+}
+
+TEST(TestLayoutHilbert, offsets) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::layout_hilbert::mapping<ext_t> map(ext_t(16, 16));
+  ASSERT_TRUE(map.is_exhaustive());
+  ASSERT_EQ(map.required_span_size(), 256);
+  std::vector<std::pair<int, int>> points(256);
+  for (int i = 0; i < 16; ++i)
+    for (int j = 0; j < 16; ++j) {
+      ASSERT_EQ(static_cast<size_t>(map(i, j)), reference_offset(16, i, j));
+      points[map(i, j)] = {i, j};
+    }
+  // Consecutive offsets are neighbors.
+  ASSERT_EQ(points[0], std::make_pair(0, 0));
+  ASSERT_EQ(points[1], std::make_pair(0, 1));
+  for (size_t d = 1; d < points.size(); ++d)
+    ASSERT_EQ(std::abs(points[d].first - points[d - 1].first) +
+              std::abs(points[d].second - points[d - 1].second), 1);
+}
+
+TEST(TestLayoutHilbert, padding) {
+  using ext_t = Kokkos::extents<size_t, dyn, 5>;
+  KokkosEx::layout_hilbert::mapping<ext_t> map(ext_t(11));
+  ASSERT_EQ(map.padded_extent(), 16u);
+  ASSERT_EQ(map.required_span_size(), 256u);
+  ASSERT_FALSE(map.is_exhaustive());
+  ASSERT_FALSE(map.is_strided());
+  std::vector<int> hits(map.required_span_size(), 0);
+  for (size_t i = 0; i < 11; ++i)
+    for (size_t j = 0; j < 5; ++j) {
+      ASSERT_EQ(map(i, j), reference_offset(16, i, j));
+      ++hits[map(i, j)];
+    }
+  for (int h : hits)
+    ASSERT_LE(h, 1);
+
+  KokkosEx::layout_hilbert::mapping<Kokkos::dextents<int, 2>> empty(Kokkos::dextents<int, 2>(0, 3));
+  ASSERT_EQ(empty.required_span_size(), 0);
+}
+
+TEST(TestLayoutHilbert, properties) {
+  using map_8x8 = KokkosEx::layout_hilbert::mapping<Kokkos::extents<int, 8, 8>>;
+  using map_1x2 = KokkosEx::layout_hilbert::mapping<Kokkos::extents<int, 1, 2>>;
+  using map_2x1 = KokkosEx::layout_hilbert::mapping<Kokkos::extents<int, 2, 1>>;
+  static_assert(map_8x8::is_always_exhaustive());
+  static_assert(!map_8x8::is_always_strided());
+  static_assert(map_1x2::is_always_strided());
+  static_assert(map_2x1::is_always_strided());
+  ASSERT_EQ(map_1x2()(0, 1), map_1x2().stride(1));
+  ASSERT_EQ(map_2x1()(1, 0), map_2x1().stride(0));
+  ASSERT_EQ(map_8x8().padded_extent(), 8);
+
+  KokkosEx::layout_hilbert::mapping<Kokkos::dextents<int, 2>> converted = map_8x8();
+  ASSERT_EQ(converted, map_8x8());
+  ASSERT_EQ(converted(5, 3), map_8x8()(5, 3));
+}
+
+TEST(TestLayoutHilbert, for_each_in_storage_order) {
+  for (auto e : {std::pair{16, 16}, std::pair{11, 5}, std::pair{1, 9}, std::pair{7, 1}, std::pair{0, 4}}) {
+    using ext_t = Kokkos::dextents<int, 2>;
+    KokkosEx::layout_hilbert::mapping<ext_t> map(ext_t(e.first, e.second));
+    int count = 0;
+    int last = -1;
+    KokkosEx::hilbert_for_each(map, [&](int offset, int i, int j) {
+      ASSERT_EQ(offset, map(i, j));
+      ASSERT_GT(offset, last);
+      ASSERT_LT(i, e.first);
+      ASSERT_LT(j, e.second);
+      last = offset;
+      ++count;
+    });
+    ASSERT_EQ(count, e.first * e.second);
+  }
+}
+
+TEST(TestLayoutHilbert, mdarray) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::mdarray<int, ext_t, KokkosEx::layout_hilbert> a(ext_t(6, 7));
+  ASSERT_EQ(a.container().size(), size_t(64));
+  KokkosEx::hilbert_for_each(a.mapping(), [&](int offset, int i, int j) {
+    a.data()[offset] = i * 7 + j;
+  });
+  auto v = a.to_mdspan();
+  static_assert(std::is_same_v<decltype(v)::layout_type, KokkosEx::layout_hilbert>);
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 7; ++j)
+      ASSERT_EQ((__MDSPAN_OP(v, i, j)), i * 7 + j);
+}
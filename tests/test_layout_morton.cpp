@@ -0,0 +1,119 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Reference: bit b of index r goes to bit b * rank + (rank - 1 - r).
+size_t reference_offset(std::vector<size_t> idx) {
+  const size_t rank = idx.size();
+  size_t offset = 0;
+  for (size_t b = 0; b * rank < 64; ++b)
+    for (size_t r = 0; r < rank; ++r)
+      offset |= ((idx[r] >> b) & 1u) << (b * rank + rank - 1 - r);
+  return offset;
+}
+
+TEST(TestLayoutMorton, offsets_2d) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::layout_morton::mapping<ext_t> map(ext_t(13, 20));
+  ASSERT_EQ(map.padded_extent(), 32);
+  ASSERT_EQ(map.required_span_size(), 32 * 32);
+  ASSERT_FALSE(map.is_exhaustive());
+  ASSERT_FALSE(map.is_strided());
+  std::vector<int> hits(map.required_span_size(), 0);
+  for (int i = 0; i < 13; ++i)
+    for (int j = 0; j < 20; ++j) {
+      ASSERT_EQ(static_cast<size_t>(map(i, j)), reference_offset({size_t(i), size_t(j)}));
+      ++hits[map(i, j)];
+    }
+  for (int h : hits)
+    ASSERT_LE(h, 1);
+
+  // 2x2 blocks are contiguous.
+  ASSERT_EQ(map(4, 6), 52);
+  ASSERT_EQ(map(4, 7), 53);
+  ASSERT_EQ(map(5, 6), 54);
+  ASSERT_EQ(map(5, 7), 55);
+}
+
+TEST(TestLayoutMorton, offsets_3d) {
+  using ext_t = Kokkos::extents<size_t, 8, dyn, 8>;
+  KokkosEx::layout_morton::mapping<ext_t> map(ext_t(8));
+  ASSERT_TRUE(map.is_exhaustive());
+  ASSERT_EQ(map.required_span_size(), 512u);
+  for (size_t i = 0; i < 8; ++i)
+    for (size_t j = 0; j < 8; ++j)
+      for (size_t k = 0; k < 8; ++k)
+        ASSERT_EQ(map(i, j, k), reference_offset({i, j, k}));
+
+  // Large indices use all dilation table bytes.
+  using big_t = Kokkos::dextents<uint64_t, 3>;
+  KokkosEx::layout_morton::mapping<big_t> big(big_t(1u << 20, 3, 1u << 19));
+  ASSERT_EQ(big.required_span_size(), uint64_t(1) << 60);
+  ASSERT_EQ(big(0xabcdeu, 2u, 0x5a5a5u), reference_offset({0xabcde, 2, 0x5a5a5}));
+  ASSERT_EQ(big((1u << 20) - 1, 1u, 0u), reference_offset({(1u << 20) - 1, 1, 0}));
+}
+
+TEST(TestLayoutMorton, properties) {
+  using map_4x4 = KokkosEx::layout_morton::mapping<Kokkos::extents<int, 4, 4>>;
+  using map_4x2 = KokkosEx::layout_morton::mapping<Kokkos::extents<int, 4, 2>>;
+  using map_2x2 = KokkosEx::layout_morton::mapping<Kokkos::extents<int, 2, 2>>;
+  static_assert(std::is_empty_v<map_4x4>);
+  static_assert(map_4x4::is_always_exhaustive());
+  static_assert(!map_4x2::is_always_exhaustive());
+  static_assert(!map_4x4::is_always_strided());
+  static_assert(map_2x2::is_always_strided());
+  ASSERT_EQ(map_2x2().stride(0), 2);
+  ASSERT_EQ(map_2x2().stride(1), 1);
+  ASSERT_EQ(map_4x2().required_span_size(), 16);
+
+  using map_1d = KokkosEx::layout_morton::mapping<Kokkos::dextents<int, 1>>;
+  map_1d m1(Kokkos::dextents<int, 1>(7));
+  ASSERT_EQ(m1.required_span_size(), 7);
+  ASSERT_EQ(m1(5), 5);
+
+  KokkosEx::layout_morton::mapping<Kokkos::dextents<int, 2>> empty(Kokkos::dextents<int, 2>(0, 9));
+  ASSERT_EQ(empty.required_span_size(), 0);
+
+  KokkosEx::layout_morton::mapping<Kokkos::dextents<int, 2>> converted = map_4x4();
+  ASSERT_EQ(converted, map_4x4());
+}
+
+TEST(TestLayoutMorton, mdspan_and_mdarray) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::mdarray<int, ext_t, KokkosEx::layout_morton> a(ext_t(6, 5));
+  ASSERT_EQ(a.container().size(), size_t(64));
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 5; ++j)
+      __MDSPAN_OP(a, i, j) = i * 5 + j;
+  ASSERT_EQ(a.data()[reference_offset({3, 4})], 19);
+
+  Kokkos::mdspan<const int, ext_t, KokkosEx::layout_morton> v = a.to_mdspan();
+  int sum = 0;
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 5; ++j)
+      sum += __MDSPAN_OP(v, i, j);
+  ASSERT_EQ(sum, 29 * 30 / 2);
+}
@@ -0,0 +1,178 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template <class Mapping>
+void check_against_layout_stride(const Mapping &map) {
+  using extents_type = typename Mapping::extents_type;
+  using index_type = typename extents_type::index_type;
+  Kokkos::layout_stride::mapping<extents_type> ref(map.extents(), map.strides());
+  ASSERT_EQ(map.required_span_size(), ref.required_span_size());
+  for (index_type i = 0; i < map.extents().extent(0); ++i)
+    for (index_type j = 0; j < map.extents().extent(1); ++j)
+      for (index_type k = 0; k < map.extents().extent(2); ++k)
+        ASSERT_EQ(map(i, j, k), ref(i, j, k));
+}
+
+TEST(TestLayoutPadded, left_static_padding) {
+  using ext_t = Kokkos::extents<size_t, 5, 3, 2>;
+  using map_t = KokkosEx::layout_left_padded<4>::mapping<ext_t>;
+  static_assert(map_t::static_padding_stride == 8);
+  static_assert(std::is_empty_v<map_t>);
+  static_assert(!map_t::is_always_exhaustive());
+  map_t map;
+  ASSERT_EQ(map.stride(0), 1);
+  ASSERT_EQ(map.stride(1), 8);
+  ASSERT_EQ(map.stride(2), 24);
+  ASSERT_EQ(map.required_span_size(), 5 + 8 * 5);
+  ASSERT_FALSE(map.is_exhaustive());
+  ASSERT_EQ(map(4, 2, 1), 4 + 2 * 8 + 1 * 24);
+  check_against_layout_stride(map);
+}
+
+TEST(TestLayoutPadded, right_static_padding) {
+  using ext_t = Kokkos::extents<size_t, 2, 3, 5>;
+  using map_t = KokkosEx::layout_right_padded<4>::mapping<ext_t>;
+  static_assert(map_t::static_padding_stride == 8);
+  static_assert(std::is_empty_v<map_t>);
+  map_t map;
+  ASSERT_EQ(map.stride(2), 1);
+  ASSERT_EQ(map.stride(1), 8);
+  ASSERT_EQ(map.stride(0), 24);
+  ASSERT_EQ(map.required_span_size(), 5 + 8 * 5);
+  ASSERT_EQ(map(1, 2, 4), 24 + 2 * 8 + 4);
+  check_against_layout_stride(map);
+}
+
+TEST(TestLayoutPadded, dynamic_padding) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  KokkosEx::layout_left_padded<>::mapping<ext_t> left(ext_t(7, 3, 2), 4);
+  ASSERT_EQ(left.stride(1), 8);
+  ASSERT_EQ(left.stride(2), 24);
+  check_against_layout_stride(left);
+
+  KokkosEx::layout_right_padded<>::mapping<ext_t> right(ext_t(2, 3, 7), 16);
+  ASSERT_EQ(right.stride(1), 16);
+  ASSERT_EQ(right.stride(0), 48);
+  check_against_layout_stride(right);
+
+  // Without explicit padding the mapping is unpadded.
+  KokkosEx::layout_left_padded<>::mapping<ext_t> unpadded(ext_t(7, 3, 2));
+  ASSERT_TRUE(unpadded.is_exhaustive());
+  ASSERT_EQ(unpadded.required_span_size(), 42);
+}
+
+TEST(TestLayoutPadded, empty_and_small_ranks) {
+  KokkosEx::layout_left_padded<4>::mapping<Kokkos::dextents<int, 2>> empty(
+      Kokkos::dextents<int, 2>(3, 0));
+  ASSERT_EQ(empty.required_span_size(), 0);
+
+  KokkosEx::layout_right_padded<4>::mapping<Kokkos::extents<int, 5>> rank1;
+  static_assert(decltype(rank1)::is_always_exhaustive());
+  ASSERT_EQ(rank1.required_span_size(), 5);
+  ASSERT_EQ(rank1(3), 3);
+
+  KokkosEx::layout_left_padded<4>::mapping<Kokkos::extents<int>> rank0;
+  ASSERT_EQ(rank0.required_span_size(), 1);
+  ASSERT_EQ(rank0(), 0);
+}
+
+TEST(TestLayoutPadded, conversions) {
+  using ext_t = Kokkos::extents<size_t, 4, dyn>;
+  Kokkos::layout_left::mapping<ext_t> left(ext_t(3));
+  KokkosEx::layout_left_padded<4>::mapping<ext_t> padded_left(left);
+  ASSERT_TRUE(padded_left.is_exhaustive());
+  ASSERT_EQ(padded_left.stride(1), 4);
+
+  Kokkos::layout_stride::mapping<ext_t> strided(ext_t(3), std::array<int, 2>{1, 8});
+  KokkosEx::layout_left_padded<>::mapping<ext_t> from_stride(strided);
+  ASSERT_EQ(from_stride.stride(1), 8);
+  ASSERT_TRUE(from_stride == (KokkosEx::layout_left_padded<8>::mapping<ext_t>(ext_t(3))));
+
+  // Static padding stride to dynamic one is implicit, the reverse is explicit.
+  using dyn_map_t = KokkosEx::layout_left_padded<>::mapping<Kokkos::dextents<size_t, 2>>;
+  using static_map_t = KokkosEx::layout_left_padded<8>::mapping<ext_t>;
+  static_assert(std::is_convertible_v<static_map_t, dyn_map_t>);
+#if MDSPAN_HAS_CXX_20
+  static_assert(!std::is_convertible_v<dyn_map_t, static_map_t>);
+#endif
+  dyn_map_t dynamic(static_map_t(ext_t(3)));
+  ASSERT_EQ(dynamic.stride(1), 8);
+  ASSERT_TRUE(dynamic == static_map_t(ext_t(3)));
+
+  Kokkos::layout_right::mapping<Kokkos::extents<int, 3, 6>> right;
+  KokkosEx::layout_right_padded<>::mapping<Kokkos::extents<int, 3, 6>> padded_right(right);
+  ASSERT_EQ(padded_right.stride(0), 6);
+}
+
+TEST(TestLayoutPadded, submdspan_preserves_padding) {
+  using ext_t = Kokkos::extents<int, 5, 6, 4>;
+  using map_t = KokkosEx::layout_left_padded<8>::mapping<ext_t>;
+  std::vector<int> data(map_t().required_span_size());
+  Kokkos::mdspan<int, ext_t, KokkosEx::layout_left_padded<8>> m(data.data());
+  for (int k = 0; k < 4; ++k)
+    for (int j = 0; j < 6; ++j)
+      for (int i = 0; i < 5; ++i)
+        __MDSPAN_OP(m, i, j, k) = i + 10 * j + 100 * k;
+
+  // Narrowed first and last kept dimensions keep the padded stride.
+  auto sub = KokkosEx::submdspan(m, std::pair{1, 4}, std::pair{2, 5}, 3);
+  static_assert(std::is_same_v<decltype(sub)::layout_type, KokkosEx::layout_left_padded<8>>);
+  ASSERT_EQ(sub.stride(1), 8);
+  ASSERT_EQ((__MDSPAN_OP(sub, 2, 1)), 3 + 30 + 300);
+
+  // A leading column is plain layout_left.
+  auto col = KokkosEx::submdspan(m, Kokkos::full_extent, 2, 1);
+  static_assert(std::is_same_v<decltype(col)::layout_type, Kokkos::layout_left>);
+  ASSERT_EQ((__MDSPAN_OP(col, 4)), 4 + 20 + 100);
+
+  // Skipping the leading dimension leaves only a strided layout.
+  auto row = KokkosEx::submdspan(m, 1, Kokkos::full_extent, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(row)::layout_type, Kokkos::layout_stride>);
+  ASSERT_EQ((__MDSPAN_OP(row, 5, 3)), 1 + 50 + 300);
+
+  Kokkos::mdspan<int, Kokkos::dextents<int, 3>, KokkosEx::layout_right_padded<>> r(
+      data.data(), KokkosEx::layout_right_padded<>::mapping<Kokkos::dextents<int, 3>>(
+                       Kokkos::dextents<int, 3>(2, 3, 5), 8));
+  auto rsub = KokkosEx::submdspan(r, 1, std::pair{1, 3}, std::pair{0, 4});
+  static_assert(std::is_same_v<decltype(rsub)::layout_type, KokkosEx::layout_right_padded<dyn>>);
+  ASSERT_EQ(rsub.stride(0), 8);
+  ASSERT_EQ((&__MDSPAN_OP(rsub, 1, 2)), (&__MDSPAN_OP(r, 1, 2, 2)));
+}
+
+TEST(TestLayoutPadded, mdarray_allocates_padded_span) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  using mapping_t = KokkosEx::layout_right_padded<16>::mapping<ext_t>;
+  KokkosEx::mdarray<double, ext_t, KokkosEx::layout_right_padded<16>> a(ext_t(3, 5));
+  ASSERT_EQ(a.mapping(), mapping_t(ext_t(3, 5)));
+  ASSERT_EQ(a.container().size(), size_t(16 * 2 + 5));
+  ASSERT_EQ(a.size(), 15);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 5; ++j)
+      __MDSPAN_OP(a, i, j) = i * 5 + j;
+  auto v = a.to_mdspan();
+  ASSERT_EQ(v.stride(0), 16);
+  ASSERT_EQ((__MDSPAN_OP(v, 2, 4)), 14);
+}
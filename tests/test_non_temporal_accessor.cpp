@@ -0,0 +1,86 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+template <class T, class Extents, class Layout = Kokkos::layout_right>
+using streaming_mdspan = Kokkos::mdspan<T, Extents, Layout, KokkosEx::non_temporal_accessor<T>>;
+
+template <class T>
+void test_streaming_stores() {
+  std::vector<T> data(12, T(0));
+  streaming_mdspan<T, Kokkos::extents<int, 3, 4>> m(data.data());
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < 4; ++j)
+      __MDSPAN_OP(m, i, j) = T(i * 4 + j);
+  __MDSPAN_OP(m, 0, 0) = __MDSPAN_OP(m, 2, 3);
+  KokkosEx::non_temporal_fence();
+  ASSERT_EQ(data[0], T(11));
+  for(int i = 1; i < 12; ++i)
+    ASSERT_EQ(data[i], T(i));
+  ASSERT_EQ(T(__MDSPAN_OP(m, 1, 2)), T(6));
+}
+
+TEST(TestNonTemporalAccessor, access) {
+  test_streaming_stores<float>();
+  test_streaming_stores<double>();
+  test_streaming_stores<int>();
+  test_streaming_stores<short>();
+}
+
+TEST(TestNonTemporalAccessor, conversions) {
+  using acc_t = KokkosEx::non_temporal_accessor<float>;
+  static_assert(std::is_convertible_v<acc_t, KokkosEx::non_temporal_accessor<const float>>);
+  static_assert(std::is_convertible_v<acc_t, Kokkos::default_accessor<float>>);
+  static_assert(!std::is_convertible_v<Kokkos::default_accessor<float>, acc_t>);
+  static_assert(std::is_same_v<KokkosEx::non_temporal_accessor<const float>::reference, const float&>);
+
+  float data[8] = {};
+  streaming_mdspan<float, Kokkos::dextents<int, 1>> a(data, 8);
+  Kokkos::mdspan<const float, Kokkos::dextents<int, 1>> b = a;
+  ASSERT_EQ(b.data_handle(), data);
+
+  // Slices of an output keep streaming.
+  auto sub = KokkosEx::submdspan(a, std::pair<int, int>{2, 6});
+  static_assert(std::is_same_v<decltype(sub)::accessor_type, KokkosEx::non_temporal_accessor<float>>);
+  __MDSPAN_OP(sub, 1) = 5.f;
+  KokkosEx::non_temporal_fence();
+  ASSERT_EQ(data[3], 5.f);
+}
+
+TEST(TestNonTemporalAccessor, copy) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  std::vector<double> a(35 * 40), b(35 * 40), c(35 * 40);
+  std::iota(a.begin(), a.end(), 0.);
+  Kokkos::mdspan<const double, ext_t> src(a.data(), 35, 40);
+
+  streaming_mdspan<double, ext_t> dst_right(b.data(), 35, 40);
+  KokkosEx::copy(src, dst_right);
+  ASSERT_EQ(a, b);
+
+  streaming_mdspan<double, ext_t, Kokkos::layout_left> dst_left(c.data(), 35, 40);
+  KokkosEx::copy(src, dst_left);
+  for(int i = 0; i < 35; ++i)
+    for(int j = 0; j < 40; ++j)
+      ASSERT_EQ(c[i + j * 35], (__MDSPAN_OP(src, i, j)));
+}
@@ -0,0 +1,194 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+using packed_mask = KokkosEx::packed_bool_accessor<bool>;
+using const_packed_mask = KokkosEx::packed_bool_accessor<const bool>;
+using ext_3d = Kokkos::dextents<int, 3>;
+
+template <class Layout = Kokkos::layout_right, class Extents>
+auto make_mask(std::vector<uint64_t> &words, Extents exts, size_t bit = 0) {
+  words.assign(KokkosEx::packed_bool_words(bit + Kokkos::layout_right::mapping<Extents>(exts).required_span_size()) + 1, 0);
+  return Kokkos::mdspan<bool, Extents, Layout, packed_mask>(
+      KokkosEx::packed_bit_pointer<uint64_t>(words.data(), bit), exts);
+}
+
+template <class MDSpan>
+void fill_random(MDSpan m, unsigned seed) {
+  std::mt19937 gen(seed);
+  for (int i = 0; i < m.extent(0); ++i)
+    for (int j = 0; j < m.extent(1); ++j)
+      for (int k = 0; k < m.extent(2); ++k)
+        __MDSPAN_OP(m, i, j, k) = (gen() & 1) != 0;
+}
+
+TEST(TestPackedBoolAccessor, access) {
+  static_assert(std::is_same_v<packed_mask::offset_policy, packed_mask>);
+  static_assert(std::is_same_v<const_packed_mask::reference, bool>);
+
+  uint64_t words[2] = {0, 0};
+  Kokkos::mdspan<bool, Kokkos::extents<int, 10, 10>, Kokkos::layout_right, packed_mask> m(words);
+  __MDSPAN_OP(m, 0, 3) = true;
+  __MDSPAN_OP(m, 6, 5) = true;
+  ASSERT_EQ(words[0], uint64_t(1) << 3);
+  ASSERT_EQ(words[1], uint64_t(1) << 1);
+  ASSERT_TRUE((__MDSPAN_OP(m, 6, 5)));
+  ASSERT_FALSE((__MDSPAN_OP(m, 6, 4)));
+
+  __MDSPAN_OP(m, 0, 3) = false;
+  __MDSPAN_OP(m, 0, 4) |= true;
+  __MDSPAN_OP(m, 6, 5) ^= true;
+  ASSERT_EQ(words[0], uint64_t(1) << 4);
+  ASSERT_EQ(words[1], uint64_t(0));
+  __MDSPAN_OP(m, 9, 9).flip();
+  ASSERT_EQ(words[1], uint64_t(1) << 35);
+
+  Kokkos::mdspan<const bool, Kokkos::extents<int, 10, 10>, Kokkos::layout_right, const_packed_mask> c = m;
+  ASSERT_EQ(c.data_handle().word(), words);
+  ASSERT_TRUE((__MDSPAN_OP(c, 9, 9)));
+  ASSERT_FALSE((__MDSPAN_OP(c, 9, 8)));
+}
+
+TEST(TestPackedBoolAccessor, submdspan) {
+  std::vector<uint64_t> words;
+  auto m = make_mask(words, ext_3d(5, 7, 9));
+  for (int i = 0; i < 5; ++i)
+    for (int j = 0; j < 7; ++j)
+      for (int k = 0; k < 9; ++k)
+        __MDSPAN_OP(m, i, j, k) = (i + j * k) % 3 == 0;
+
+  // Starts at bit 2 * 63 + 3 * 9 + 1 = 154 of the mask.
+  auto s = KokkosEx::submdspan(m, 2, std::pair{3, 7}, std::pair{1, 8});
+  static_assert(std::is_same_v<decltype(s)::accessor_type, packed_mask>);
+  ASSERT_EQ(s.data_handle().word(), words.data() + 2);
+  ASSERT_EQ(s.data_handle().bit(), size_t(26));
+  for (int j = 0; j < 4; ++j)
+    for (int k = 0; k < 7; ++k)
+      ASSERT_EQ(bool(__MDSPAN_OP(s, j, k)), (2 + (j + 3) * (k + 1)) % 3 == 0);
+
+  __MDSPAN_OP(s, 3, 6) = true;
+  ASSERT_TRUE(bool(__MDSPAN_OP(m, 2, 6, 7)));
+}
+
+TEST(TestPackedBoolAccessor, mask_count) {
+  std::vector<uint64_t> words;
+  for (size_t bit : {0, 1, 37, 63}) {
+    auto m = make_mask(words, ext_3d(3, 11, 13), bit);
+    fill_random(m, unsigned(bit));
+    size_t expected = 0;
+    for (int i = 0; i < 3; ++i)
+      for (int j = 0; j < 11; ++j)
+        for (int k = 0; k < 13; ++k)
+          expected += bool(__MDSPAN_OP(m, i, j, k));
+    // Bits outside of the mask must not be counted.
+    words.front() |= (uint64_t(1) << bit) - 1;
+    words.back() = ~uint64_t(0);
+    ASSERT_EQ(KokkosEx::mask_count(m), expected);
+
+    auto row = KokkosEx::submdspan(m, 1, 4, Kokkos::full_extent);
+    size_t row_expected = 0;
+    for (int k = 0; k < 13; ++k)
+      row_expected += bool(__MDSPAN_OP(row, k));
+    ASSERT_EQ(KokkosEx::mask_count(row), row_expected);
+  }
+
+  bool bytes[6] = {true, false, true, true, false, true};
+  ASSERT_EQ(KokkosEx::mask_count(Kokkos::mdspan<bool, Kokkos::extents<int, 2, 3>>(bytes)), size_t(4));
+}
+
+TEST(TestPackedBoolAccessor, mask_operations) {
+  const ext_3d exts(4, 9, 23);
+  std::vector<uint64_t> wa, wb, wd;
+  // Same and different bit offsets of the operands.
+  for (auto offsets : {std::array<size_t, 3>{0, 0, 0}, std::array<size_t, 3>{5, 5, 5},
+                       std::array<size_t, 3>{3, 60, 17}, std::array<size_t, 3>{0, 33, 1}}) {
+    auto a = make_mask(wa, exts, offsets[0]);
+    auto b = make_mask(wb, exts, offsets[1]);
+    auto d = make_mask(wd, exts, offsets[2]);
+    fill_random(a, 1);
+    fill_random(b, 2);
+    // Bits of d outside of the mask must survive.
+    wd.front() = (uint64_t(1) << offsets[2]) - 1;
+    wd.back() = ~uint64_t(0);
+    const auto front = wd.front();
+
+    auto check = [&](auto op) {
+      for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 9; ++j)
+          for (int k = 0; k < 23; ++k)
+            ASSERT_EQ(bool(__MDSPAN_OP(d, i, j, k)),
+                      op(bool(__MDSPAN_OP(a, i, j, k)), bool(__MDSPAN_OP(b, i, j, k))));
+      ASSERT_EQ(wd.front() & front, front);
+      ASSERT_EQ(wd.back(), ~uint64_t(0));
+    };
+    KokkosEx::mask_and(a, b, d);
+    check([](bool x, bool y) { return x && y; });
+    KokkosEx::mask_or(a, b, d);
+    check([](bool x, bool y) { return x || y; });
+    KokkosEx::mask_xor(a, b, d);
+    check([](bool x, bool y) { return x != y; });
+    KokkosEx::mask_not(a, d);
+    check([](bool x, bool) { return !x; });
+  }
+
+  // In place
+  auto a = make_mask(wa, exts, 7);
+  auto b = make_mask(wb, exts, 7);
+  fill_random(a, 3);
+  fill_random(b, 4);
+  const auto count_a = KokkosEx::mask_count(a);
+  KokkosEx::mask_xor(a, b, a);
+  KokkosEx::mask_xor(a, b, a);
+  ASSERT_EQ(KokkosEx::mask_count(a), count_a);
+}
+
+TEST(TestPackedBoolAccessor, mask_operations_fallback) {
+  const ext_3d exts(3, 5, 7);
+  std::vector<uint64_t> wa, wd;
+  auto a = make_mask(wa, exts);
+  fill_random(a, 5);
+  auto bytes = std::make_unique<bool[]>(3 * 5 * 7);
+  Kokkos::mdspan<bool, ext_3d> b(bytes.get(), exts);
+  fill_random(b, 6);
+
+  // Packed masks with different layouts, and byte masks.
+  auto d = make_mask<Kokkos::layout_left>(wd, exts);
+  KokkosEx::mask_or(a, b, d);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 5; ++j)
+      for (int k = 0; k < 7; ++k)
+        ASSERT_EQ(bool(__MDSPAN_OP(d, i, j, k)),
+                  bool(__MDSPAN_OP(a, i, j, k)) || (__MDSPAN_OP(b, i, j, k)));
+  KokkosEx::mask_and(a, d, b);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 5; ++j)
+      for (int k = 0; k < 7; ++k)
+        ASSERT_EQ((__MDSPAN_OP(b, i, j, k)), bool(__MDSPAN_OP(a, i, j, k)));
+  ASSERT_EQ(KokkosEx::mask_count(b), KokkosEx::mask_count(a));
+}
@@ -0,0 +1,64 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+TEST(TestPrefetchingAccessor, access) {
+  std::vector<int> data(24);
+  std::iota(data.begin(), data.end(), 0);
+  using acc_t = KokkosEx::prefetching_accessor<int>;
+  // Prefetching far past the end of the allocation is harmless.
+  Kokkos::mdspan<int, Kokkos::extents<int, 4, 6>, Kokkos::layout_right, acc_t>
+    m(data.data(), Kokkos::layout_right::mapping<Kokkos::extents<int, 4, 6>>(), acc_t(1000));
+  ASSERT_EQ(m.accessor().prefetch_distance(), 1000u);
+  ASSERT_EQ((__MDSPAN_OP(m, 3, 5)), 23);
+  __MDSPAN_OP(m, 1, 1) = -1;
+  ASSERT_EQ(data[7], -1);
+
+  static_assert(std::is_convertible_v<acc_t, KokkosEx::prefetching_accessor<const int>>);
+  static_assert(std::is_convertible_v<acc_t, Kokkos::default_accessor<int>>);
+  static_assert(!std::is_convertible_v<Kokkos::default_accessor<int>, acc_t>);
+  KokkosEx::prefetching_accessor<const int> c = m.accessor();
+  ASSERT_EQ(c.prefetch_distance(), 1000u);
+}
+
+TEST(TestPrefetchingAccessor, with_prefetch) {
+  std::vector<double> data(8 * 10 * 12);
+  std::iota(data.begin(), data.end(), 0.);
+  Kokkos::mdspan<double, Kokkos::extents<int, 8, 10, 12>> s(data.data());
+  auto sub = KokkosEx::submdspan(s, KokkosEx::strided_slice<int, int, int>{0, 8, 2},
+                                 Kokkos::full_extent, KokkosEx::strided_slice<int, int, int>{1, 11, 3});
+
+  auto p = KokkosEx::with_prefetch(sub);
+  static_assert(std::is_same_v<decltype(p)::layout_type, Kokkos::layout_stride>);
+  ASSERT_EQ(p.accessor().prefetch_distance(), 3u * KokkosEx::default_prefetch_steps);
+  ASSERT_EQ(KokkosEx::with_prefetch(sub, 0, 4).accessor().prefetch_distance(), 2u * 120 * 4);
+
+  // Prefetching does not change the values seen, also through submdspans.
+  auto p_sub = KokkosEx::submdspan(p, 1, Kokkos::full_extent, Kokkos::full_extent);
+  static_assert(std::is_same_v<decltype(p_sub)::accessor_type, KokkosEx::prefetching_accessor<double>>);
+  ASSERT_EQ(p_sub.accessor().prefetch_distance(), p.accessor().prefetch_distance());
+  for(int i = 0; i < sub.extent(0); ++i)
+    for(int j = 0; j < sub.extent(1); ++j)
+      for(int k = 0; k < sub.extent(2); ++k)
+        ASSERT_EQ((__MDSPAN_OP(p, i, j, k)), (__MDSPAN_OP(sub, i, j, k)));
+}
@@ -0,0 +1,110 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+TEST(TestQuantizedAccessor, float16_format) {
+  using f16 = KokkosEx::float16_format;
+  ASSERT_EQ(f16::encode(1.f), 0x3c00);
+  ASSERT_EQ(f16::encode(-2.f), 0xc000);
+  ASSERT_EQ(f16::encode(65504.f), 0x7bff);
+  ASSERT_EQ(f16::encode(65519.f), 0x7bff);
+  ASSERT_EQ(f16::encode(65520.f), 0x7c00);
+  ASSERT_EQ(f16::encode(std::ldexp(1.f, -24)), 0x0001);
+  ASSERT_EQ(f16::encode(std::ldexp(1.f, -26)), 0x0000);
+  // Ties to even: 1 + 2^-11 is halfway between 1 and 1 + 2^-10.
+  ASSERT_EQ(f16::encode(1.f + std::ldexp(1.f, -11)), 0x3c00);
+  ASSERT_EQ(f16::encode(1.f + 3 * std::ldexp(1.f, -11)), 0x3c02);
+  ASSERT_TRUE(std::isnan(f16::decode(f16::encode(std::numeric_limits<float>::quiet_NaN()))));
+
+  // Every finite half survives a round trip through float.
+  for(uint32_t h = 0; h < 0x10000; ++h) {
+    if(((h >> 10) & 0x1f) == 0x1f) continue;
+    ASSERT_EQ(f16::encode(f16::decode(uint16_t(h))), h);
+  }
+  ASSERT_EQ(f16::decode(0x0001), std::ldexp(1.f, -24));
+  ASSERT_EQ(f16::decode(0x3555), 0.333251953125f);
+}
+
+TEST(TestQuantizedAccessor, bfloat16_and_integer_formats) {
+  using bf16 = KokkosEx::bfloat16_format;
+  ASSERT_EQ(bf16::encode(1.f), 0x3f80);
+  ASSERT_EQ(bf16::decode(bf16::encode(-3.5f)), -3.5f);
+  ASSERT_EQ(bf16::decode(bf16::encode(1.f + std::ldexp(1.f, -8))), 1.f);
+
+  using i8 = KokkosEx::integer_format<int8_t>;
+  ASSERT_EQ(i8::encode(2.5f), 3);
+  ASSERT_EQ(i8::encode(-2.5f), -3);
+  ASSERT_EQ(i8::encode(1000.f), 127);
+  ASSERT_EQ(i8::encode(-1000.f), -128);
+  ASSERT_EQ(i8::encode(std::numeric_limits<float>::quiet_NaN()), 0);
+  ASSERT_EQ(KokkosEx::quantization_scale<i8>(254.), 2.);
+}
+
+TEST(TestQuantizedAccessor, mdspan) {
+  using acc_t = KokkosEx::quantized_accessor<float, KokkosEx::integer_format<int8_t>>;
+  std::vector<int8_t> storage(3 * 4);
+  Kokkos::mdspan<float, Kokkos::extents<int, 3, dyn>, Kokkos::layout_right, acc_t>
+    q(storage.data(), Kokkos::layout_right::mapping<Kokkos::extents<int, 3, dyn>>(Kokkos::extents<int, 3, dyn>(4)), acc_t(0.5f));
+  static_assert(std::is_same_v<decltype(q)::data_handle_type, int8_t*>);
+
+  __MDSPAN_OP(q, 1, 2) = 3.f;
+  ASSERT_EQ(storage[6], 6);
+  ASSERT_EQ(float(__MDSPAN_OP(q, 1, 2)), 3.f);
+  __MDSPAN_OP(q, 1, 2) += 1.2f; // 4.2 is stored as 4
+  ASSERT_EQ(float(__MDSPAN_OP(q, 1, 2)), 4.f);
+  __MDSPAN_OP(q, 0, 0) = __MDSPAN_OP(q, 1, 2);
+  ASSERT_EQ(storage[0], 8);
+
+  // Slices keep the scale, read-only views decode to values.
+  auto row = KokkosEx::submdspan(q, 1, Kokkos::full_extent);
+  ASSERT_EQ(row.accessor().scale(), 0.5f);
+  ASSERT_EQ(float(__MDSPAN_OP(row, 2)), 4.f);
+  Kokkos::mdspan<const float, Kokkos::extents<int, 3, dyn>, Kokkos::layout_right,
+                 KokkosEx::quantized_accessor<const float, KokkosEx::integer_format<int8_t>>> cq = q;
+  static_assert(std::is_same_v<decltype(cq)::reference, float>);
+  ASSERT_EQ((__MDSPAN_OP(cq, 0, 0)), 4.f);
+}
+
+TEST(TestQuantizedAccessor, copy) {
+  std::vector<double> src_data(6 * 7);
+  for(size_t i = 0; i < src_data.size(); ++i)
+    src_data[i] = 0.25 * double(i) - 3.;
+  Kokkos::mdspan<double, Kokkos::dextents<int, 2>> src(src_data.data(), 6, 7);
+
+  using acc_t = KokkosEx::quantized_accessor<double, KokkosEx::float16_format>;
+  std::vector<uint16_t> storage(6 * 7);
+  Kokkos::mdspan<double, Kokkos::dextents<int, 2>, Kokkos::layout_left, acc_t>
+    q(storage.data(), Kokkos::layout_left::mapping<Kokkos::dextents<int, 2>>(Kokkos::dextents<int, 2>(6, 7)), acc_t());
+  KokkosEx::copy(src, q);
+
+  std::vector<double> back_data(6 * 7);
+  Kokkos::mdspan<double, Kokkos::dextents<int, 2>> back(back_data.data(), 6, 7);
+  KokkosEx::copy(q, back);
+  // Multiples of 1/4 below 8 in magnitude are exact in binary16.
+  ASSERT_EQ(back_data, src_data);
+}
@@ -0,0 +1,195 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <vector>
+#if MDSPAN_USE_STD_EXECUTION
+#include <execution>
+#endif
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Accessor returning elements by value, so element ranges can not hand out
+// pointers.
+template<class ElementType>
+struct negating_accessor {
+  using offset_policy = negating_accessor;
+  using element_type = const ElementType;
+  using reference = ElementType;
+  using data_handle_type = const ElementType*;
+
+  reference access(data_handle_type p, size_t i) const noexcept { return -p[i]; }
+  data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+};
+
+#if MDSPAN_HAS_CXX_20
+static_assert(std::random_access_iterator<
+              KokkosEx::index_iterator<Kokkos::extents<int, dyn, 3>>>);
+static_assert(std::random_access_iterator<
+              KokkosEx::element_iterator<negating_accessor<int>>>);
+static_assert(std::contiguous_iterator<
+              KokkosEx::element_range<Kokkos::mdspan<int, Kokkos::dextents<int, 2>>>::iterator>);
+#endif
+
+TEST(TestIndexRange, test_index_range_order) {
+  Kokkos::extents<int, 2, dyn, 4> exts(3);
+  auto r = KokkosEx::indices(exts);
+  ASSERT_EQ(r.size(), 24u);
+  ASSERT_FALSE(r.empty());
+  ASSERT_EQ(r.end() - r.begin(), 24);
+
+  int n = 0;
+  for (auto idx : r) {
+    ASSERT_EQ(idx[0], n / 12);
+    ASSERT_EQ(idx[1], n / 4 % 3);
+    ASSERT_EQ(idx[2], n % 4);
+    ASSERT_EQ(r[n], idx);
+    ++n;
+  }
+  ASSERT_EQ(n, 24);
+}
+
+TEST(TestIndexRange, test_index_range_random_access) {
+  Kokkos::extents<size_t, dyn, dyn, dyn> exts(3, 5, 2);
+  KokkosEx::index_range<decltype(exts)> r(exts);
+
+  // Jumps agree with stepping, in both directions.
+  auto it = r.begin();
+  for (std::ptrdiff_t k = 0; k < 30; ++k, ++it) {
+    ASSERT_EQ(*(r.begin() + k), *it);
+    ASSERT_EQ(r.begin()[k], *it);
+    ASSERT_EQ(it - r.begin(), k);
+  }
+  ASSERT_EQ(it, r.end());
+  for (std::ptrdiff_t k = 30; k > 0;) {
+    --it;
+    --k;
+    ASSERT_EQ(*it, *(r.end() - (30 - k)));
+  }
+  ASSERT_EQ(it, r.begin());
+  ASSERT_TRUE(r.begin() < r.end());
+  ASSERT_TRUE(r.end() >= r.begin() + 30);
+
+  auto found = std::find(r.begin(), r.end(), std::array<size_t, 3>{2, 1, 1});
+  ASSERT_EQ(found - r.begin(), 2 * 10 + 1 * 2 + 1);
+}
+
+TEST(TestIndexRange, test_index_range_edge_cases) {
+  auto empty = KokkosEx::indices(Kokkos::extents<int, 3, dyn>(0));
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.begin(), empty.end());
+
+  auto scalar = KokkosEx::indices(Kokkos::extents<int>());
+  ASSERT_EQ(scalar.size(), 1u);
+  ASSERT_EQ(std::distance(scalar.begin(), scalar.end()), 1);
+}
+
+TEST(TestIndexRange, test_index_range_algorithms) {
+  std::vector<int> data(6 * 7);
+  Kokkos::mdspan<int, Kokkos::extents<int, dyn, 7>, Kokkos::layout_left> s(data.data(), 6);
+  auto r = KokkosEx::indices(s);
+  std::for_each(r.begin(), r.end(), [=](auto idx) {
+    __MDSPAN_OP(s, idx) = idx[0] * 10 + idx[1];
+  });
+  for (int i = 0; i < 6; ++i)
+    for (int j = 0; j < 7; ++j)
+      ASSERT_EQ(data[i + 6 * j], i * 10 + j);
+
+  ASSERT_EQ(std::count_if(r.begin(), r.end(),
+                          [](auto idx) { return idx[0] == idx[1]; }), 6);
+}
+
+#if MDSPAN_USE_STD_EXECUTION
+TEST(TestIndexRange, test_index_range_parallel) {
+  std::vector<int> data(50 * 60);
+  Kokkos::mdspan<int, Kokkos::dextents<int, 2>> s(data.data(), 50, 60);
+  auto r = KokkosEx::indices(s);
+  std::for_each(std::execution::par_unseq, r.begin(), r.end(), [=](auto idx) {
+    __MDSPAN_OP(s, idx) = idx[0] * 100 + idx[1];
+  });
+  for (int i = 0; i < 50; ++i)
+    for (int j = 0; j < 60; ++j)
+      ASSERT_EQ((__MDSPAN_OP(s, i, j)), i * 100 + j);
+
+  auto e = KokkosEx::elements(s);
+  ASSERT_EQ(std::reduce(std::execution::par_unseq, e.begin(), e.end()),
+            std::accumulate(data.begin(), data.end(), 0));
+}
+#endif
+
+TEST(TestElementRange, test_element_range_contiguous) {
+  std::vector<int> data(4 * 5);
+  std::iota(data.begin(), data.end(), 0);
+  Kokkos::mdspan<int, Kokkos::extents<int, 4, dyn>> s(data.data(), 5);
+  auto e = KokkosEx::elements(s);
+  static_assert(decltype(e)::is_contiguous, "");
+  static_assert(std::is_same<decltype(e.begin()), int*>::value, "");
+  ASSERT_EQ(e.size(), 20u);
+  ASSERT_EQ(e.data(), data.data());
+  ASSERT_EQ(e.end() - e.begin(), 20);
+  ASSERT_EQ(std::accumulate(e.begin(), e.end(), 0), 190);
+
+  std::fill(e.begin(), e.end(), 3);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j)
+      ASSERT_EQ((__MDSPAN_OP(s, i, j)), 3);
+}
+
+TEST(TestElementRange, test_element_range_stride) {
+  // Exhaustive layout_stride with a dimension order of neither left nor right.
+  std::vector<int> data(2 * 3 * 4);
+  using exts_t = Kokkos::extents<int, 2, 3, 4>;
+  Kokkos::layout_stride::mapping<exts_t> map(exts_t(), std::array<int, 3>{4, 8, 1});
+  Kokkos::mdspan<int, exts_t, Kokkos::layout_stride> s(data.data(), map);
+  auto e = KokkosEx::elements(s);
+  ASSERT_EQ(e.size(), 24u);
+  std::iota(e.begin(), e.end(), 0);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k)
+        ASSERT_EQ((__MDSPAN_OP(s, i, j, k)), map(i, j, k));
+}
+
+TEST(TestElementRange, test_element_range_accessor) {
+  std::vector<int> data(3 * 4);
+  std::iota(data.begin(), data.end(), 1);
+  Kokkos::mdspan<const int, Kokkos::dextents<int, 2>, Kokkos::layout_right,
+                 negating_accessor<int>> s(data.data(), 3, 4);
+  auto e = KokkosEx::elements(s);
+  static_assert(!decltype(e)::is_contiguous, "");
+  ASSERT_EQ(e.size(), 12u);
+  ASSERT_EQ(e[5], -6);
+  ASSERT_EQ(e.begin()[11], -12);
+  ASSERT_EQ(std::accumulate(e.begin(), e.end(), 0), -78);
+  ASSERT_EQ(*std::min_element(e.begin(), e.end()), -12);
+
+  auto scalar = KokkosEx::elements(
+      Kokkos::mdspan<const int, Kokkos::extents<int>, Kokkos::layout_right,
+                     negating_accessor<int>>(data.data()));
+  ASSERT_EQ(scalar.size(), 1u);
+  ASSERT_EQ(*scalar.begin(), -1);
+}
@@ -0,0 +1,100 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/algorithm.hpp>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Accessor the reduction kernels can not bypass, exercising the generic path.
+template<class ElementType>
+struct negating_accessor {
+  using offset_policy = negating_accessor;
+  using element_type = ElementType;
+  using reference = ElementType;
+  using data_handle_type = ElementType*;
+
+  reference access(data_handle_type p, size_t i) const noexcept { return -p[i]; }
+  data_handle_type offset(data_handle_type p, size_t i) const noexcept { return p + i; }
+};
+
+template<class Policy, class MDSpan>
+void test_reduce_sum(Policy policy, MDSpan s, long expected) {
+  ASSERT_EQ(KokkosEx::reduce(policy, s, 0l, std::plus<>()), expected);
+  ASSERT_EQ(KokkosEx::reduce(policy, s, 10l, std::plus<>()), expected + 10);
+}
+
+template<class Policy>
+void test_reduce_policy(Policy policy) {
+  std::vector<int> data(6 * 7 * 5);
+  std::iota(data.begin(), data.end(), 1);
+  const long total = std::accumulate(data.begin(), data.end(), 0l);
+
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::dextents<int, 1>>(data.data(), data.size()), total);
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::extents<int, 6, dyn, 5>>(data.data(), 7), total);
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::dextents<int, 3>, Kokkos::layout_left>(data.data(), 6, 7, 5), total);
+  test_reduce_sum(policy, Kokkos::mdspan<const int, Kokkos::dextents<int, 2>>(data.data(), 1, 210), total);
+
+  // Odd rows of a 14x15 layout_right view, seen through layout_stride.
+  Kokkos::mdspan<int, Kokkos::dextents<int, 2>> m(data.data(), 14, 15);
+  auto sub = KokkosEx::submdspan(m, KokkosEx::strided_slice<int, int, int>{1, 13, 2}, Kokkos::full_extent);
+  long expected = 0;
+  for(int i = 0; i < sub.extent(0); ++i)
+    for(int j = 0; j < sub.extent(1); ++j)
+      expected += __MDSPAN_OP(sub, i, j);
+  test_reduce_sum(policy, sub, expected);
+
+  // Generic path
+  Kokkos::mdspan<int, Kokkos::dextents<int, 3>, Kokkos::layout_right, negating_accessor<int>> neg(data.data(), 6, 7, 5);
+  test_reduce_sum(policy, neg, -total);
+
+  // Not commutative with init: max must still see every element
+  ASSERT_EQ(KokkosEx::reduce(policy, Kokkos::mdspan<int, Kokkos::dextents<int, 2>>(data.data(), 21, 10), -1,
+                             [](int a, int b) { return std::max(a, b); }), 210);
+
+  // Empty and rank 0
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::dextents<int, 2>>(data.data(), 0, 3), 0);
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::dextents<int, 2>>(data.data(), 3, 0), 0);
+  test_reduce_sum(policy, Kokkos::mdspan<int, Kokkos::extents<int>>(data.data() + 4), 5);
+}
+
+TEST(TestReduce, sequenced) {
+  test_reduce_policy(KokkosEx::execution::seq);
+  std::vector<double> data(12, 0.5);
+  ASSERT_EQ(KokkosEx::reduce(Kokkos::mdspan<double, Kokkos::extents<int, 3, 4>>(data.data()), 0.0, std::plus<>()), 6.0);
+}
+
+TEST(TestReduce, openmp) {
+  test_reduce_policy(KokkosEx::execution::openmp);
+  // More threads than slices of the outer loop
+  test_reduce_policy(KokkosEx::execution::openmp_policy{3});
+  test_reduce_policy(KokkosEx::execution::openmp_policy{64});
+}
+
+#if MDSPAN_USE_STD_EXECUTION
+TEST(TestReduce, std_execution) {
+  test_reduce_policy(std::execution::seq);
+  test_reduce_policy(std::execution::par);
+  test_reduce_policy(std::execution::par_unseq);
+}
+#endif
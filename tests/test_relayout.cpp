@@ -0,0 +1,123 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/algorithm.hpp>
+#include <mdspan/mdarray.hpp>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+// 4 byte elements take the in-register kernels, the others don't.
+template<class T>
+struct TestRelayout : public ::testing::Test {};
+
+using relayout_types = ::testing::Types<float, int32_t, double, int64_t, int16_t>;
+TYPED_TEST_SUITE(TestRelayout, relayout_types);
+
+template<class T, class LayoutSrc, class LayoutDst>
+void test_relayout_2d(int rows, int cols) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  std::vector<T> src_buf(rows * cols), dst_buf(rows * cols, T(-1));
+  Kokkos::mdspan<T, ext_t, LayoutSrc> src(src_buf.data(), rows, cols);
+  Kokkos::mdspan<T, ext_t, LayoutDst> dst(dst_buf.data(), rows, cols);
+  for(int i = 0; i < rows; ++i)
+    for(int j = 0; j < cols; ++j)
+      __MDSPAN_OP(src, i, j) = T(i * cols + j);
+  KokkosEx::relayout(src, dst);
+  for(int i = 0; i < rows; ++i)
+    for(int j = 0; j < cols; ++j)
+      ASSERT_EQ((__MDSPAN_OP(dst, i, j)), T(i * cols + j)) << rows << "x" << cols;
+}
+
+TYPED_TEST(TestRelayout, left_right_2d) {
+  // Sizes around the block and leaf edges, including remainders on both sides.
+  for(int rows : {1, 3, 4, 7, 8, 9, 32, 33, 70})
+    for(int cols : {1, 2, 5, 8, 16, 31, 65}) {
+      test_relayout_2d<TypeParam, Kokkos::layout_left, Kokkos::layout_right>(rows, cols);
+      test_relayout_2d<TypeParam, Kokkos::layout_right, Kokkos::layout_left>(rows, cols);
+    }
+}
+
+TYPED_TEST(TestRelayout, left_right_3d) {
+  using T = TypeParam;
+  using ext_t = Kokkos::extents<int, 3, Kokkos::dynamic_extent, Kokkos::dynamic_extent>;
+  const int n1 = 13, n2 = 21;
+  std::vector<T> src_buf(3 * n1 * n2), dst_buf(3 * n1 * n2, T(-1));
+  Kokkos::mdspan<T, ext_t, Kokkos::layout_left> src(src_buf.data(), n1, n2);
+  Kokkos::mdspan<T, ext_t, Kokkos::layout_right> dst(dst_buf.data(), n1, n2);
+  for(int i = 0; i < 3; ++i)
+    for(int j = 0; j < n1; ++j)
+      for(int k = 0; k < n2; ++k)
+        __MDSPAN_OP(src, i, j, k) = T((i * n1 + j) * n2 + k);
+  KokkosEx::relayout(src, dst);
+  for(size_t k = 0; k < dst_buf.size(); ++k)
+    ASSERT_EQ(dst_buf[k], T(k));
+}
+
+TYPED_TEST(TestRelayout, large) {
+  // Deep enough for several levels of recursion, then too large for the
+  // in-register path.
+  test_relayout_2d<TypeParam, Kokkos::layout_left, Kokkos::layout_right>(301, 517);
+  test_relayout_2d<TypeParam, Kokkos::layout_right, Kokkos::layout_left>(517, 301);
+  test_relayout_2d<TypeParam, Kokkos::layout_left, Kokkos::layout_right>(1500, 1501);
+}
+
+TEST(TestRelayout, layout_stride) {
+  // Every other column of a row major array into a column major one: the
+  // source is not unit stride, so the scalar fallback is used.
+  using ext_t = Kokkos::dextents<int, 2>;
+  std::vector<float> src_buf(40 * 100), dst_buf(40 * 50);
+  Kokkos::layout_stride::mapping<ext_t> src_map(ext_t(40, 50), std::array<int, 2>{100, 2});
+  Kokkos::mdspan<float, ext_t, Kokkos::layout_stride> src(src_buf.data(), src_map);
+  Kokkos::mdspan<float, ext_t, Kokkos::layout_left> dst(dst_buf.data(), 40, 50);
+  for(size_t i = 0; i < src_buf.size(); ++i)
+    src_buf[i] = float(i);
+  KokkosEx::relayout(src, dst);
+  for(int i = 0; i < 40; ++i)
+    for(int j = 0; j < 50; ++j)
+      ASSERT_EQ((__MDSPAN_OP(dst, i, j)), (__MDSPAN_OP(src, i, j)));
+
+  // Column major viewed through layout_stride into row major: unit strides on
+  // both sides, so the in-register kernels apply.
+  Kokkos::layout_stride::mapping<ext_t> col_map(ext_t(40, 50), std::array<int, 2>{1, 40});
+  Kokkos::mdspan<float, ext_t, Kokkos::layout_stride> col(src_buf.data(), col_map);
+  Kokkos::mdspan<float, ext_t, Kokkos::layout_right> row(dst_buf.data(), 40, 50);
+  KokkosEx::relayout(col, row);
+  for(int i = 0; i < 40; ++i)
+    for(int j = 0; j < 50; ++j)
+      ASSERT_EQ((__MDSPAN_OP(row, i, j)), (__MDSPAN_OP(col, i, j)));
+}
+
+TEST(TestRelayout, mdarray) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  KokkosEx::mdarray<double, ext_t, Kokkos::layout_left> a(45, 37);
+  for(int i = 0; i < 45; ++i)
+    for(int j = 0; j < 37; ++j)
+      __MDSPAN_OP(a, i, j) = i * 37 + j;
+  auto b = KokkosEx::relayout<Kokkos::layout_right>(a);
+  static_assert(std::is_same<decltype(b),
+      KokkosEx::mdarray<double, ext_t, Kokkos::layout_right>>::value, "");
+  ASSERT_EQ(b.extents(), a.extents());
+  for(int i = 0; i < 45; ++i)
+    for(int j = 0; j < 37; ++j)
+      ASSERT_EQ((__MDSPAN_OP(b, i, j)), i * 37 + j);
+  // Row major storage order.
+  for(int k = 0; k < 45 * 37; ++k)
+    ASSERT_EQ(b.container()[k], k);
+}
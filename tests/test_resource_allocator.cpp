@@ -0,0 +1,159 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/mdarray.hpp>
+#include <cstdint>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+using ext_t = Kokkos::dextents<int, 2>;
+
+template <class MDArray>
+void fill_and_check(MDArray& a) {
+  for (int i = 0; i < a.extent(0); ++i)
+    for (int j = 0; j < a.extent(1); ++j)
+      __MDSPAN_OP(a, i, j) = i * a.extent(1) + j;
+  for (int i = 0; i < a.extent(0); ++i)
+    for (int j = 0; j < a.extent(1); ++j)
+      ASSERT_EQ((__MDSPAN_OP(a, i, j)), i * a.extent(1) + j);
+}
+
+bool cache_line_aligned(const void* p) {
+  return reinterpret_cast<std::uintptr_t>(p) % 64 == 0;
+}
+
+TEST(TestArenaResource, mdarray) {
+  KokkosEx::arena_resource arena(4096);
+  KokkosEx::arena_mdarray<double, ext_t> a(ext_t(5, 7), &arena);
+  KokkosEx::arena_mdarray<double, ext_t, Kokkos::layout_left> b(ext_t(3, 4), KokkosEx::arena_allocator<double>(&arena));
+  ASSERT_TRUE(cache_line_aligned(a.data()));
+  ASSERT_TRUE(cache_line_aligned(b.data()));
+  ASSERT_GE(b.data(), a.data() + 35);
+  fill_and_check(a);
+  fill_and_check(b);
+  ASSERT_EQ(&a.container().get_allocator().resource(), &arena);
+  // Copies draw from the same arena.
+  auto c = a;
+  ASSERT_EQ(&c.container().get_allocator().resource(), &arena);
+  ASSERT_EQ((__MDSPAN_OP(c, 4, 6)), 34.);
+}
+
+TEST(TestArenaResource, reset) {
+  KokkosEx::arena_resource arena(1024);
+  void* first = nullptr;
+  for (int step = 0; step < 3; ++step) {
+    {
+      // Larger than one block in total.
+      KokkosEx::arena_mdarray<float, ext_t> a(ext_t(10, 20), &arena);
+      KokkosEx::arena_mdarray<float, ext_t> b(ext_t(20, 20), &arena);
+      KokkosEx::arena_mdarray<int, ext_t> c(ext_t(4, 4), &arena);
+      fill_and_check(a);
+      fill_and_check(b);
+      fill_and_check(c);
+      // Each step starts at the beginning of the arena.
+      if (step > 0) {
+        ASSERT_EQ(static_cast<void*>(a.data()), first);
+      }
+    }
+    const size_t capacity = arena.capacity();
+    arena.reset();
+    // Blocks merged into one of the same total size, which the next step
+    // fits without growing.
+    ASSERT_EQ(arena.capacity(), capacity);
+    first = arena.allocate(1);
+    arena.reset();
+  }
+}
+
+TEST(TestArenaResource, deallocate_last) {
+  KokkosEx::arena_resource arena(4096);
+  void* p = arena.allocate(100);
+  void* q = arena.allocate(100);
+  arena.deallocate(q, 100);
+  ASSERT_EQ(arena.allocate(100), q);
+  // Only the most recent allocation is taken back.
+  arena.deallocate(p, 100);
+  ASSERT_NE(arena.allocate(100), p);
+  // Larger than a block: a block of its own.
+  void* big = arena.allocate(10000, 256);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(big) % 256, 0u);
+}
+
+TEST(TestPoolResource, mdarray) {
+  KokkosEx::pool_resource pool;
+  void* first = nullptr;
+  for (int step = 0; step < 3; ++step) {
+    KokkosEx::pool_mdarray<double, ext_t> a(ext_t(5, 7), &pool);
+    KokkosEx::pool_mdarray<double, ext_t> b(ext_t(5, 7), &pool);
+    ASSERT_TRUE(cache_line_aligned(a.data()));
+    ASSERT_NE(a.data(), b.data());
+    fill_and_check(a);
+    fill_and_check(b);
+    // Freed blocks are handed out again.
+    if (step == 0)
+      first = a.data();
+    else
+      ASSERT_TRUE(a.data() == first || b.data() == first);
+  }
+}
+
+TEST(TestPoolResource, size_classes) {
+  KokkosEx::pool_resource pool(1 << 16, 1 << 12);
+  std::set<void*> live;
+  for (size_t bytes : {1, 64, 65, 100, 128, 1000, 4096, 5000, 65536}) {
+    for (int k = 0; k < 5; ++k) {
+      void* p = pool.allocate(bytes);
+      ASSERT_TRUE(cache_line_aligned(p));
+      ASSERT_TRUE(live.insert(p).second);
+    }
+  }
+  // Deallocated blocks are reused within their class.
+  void* p = pool.allocate(300);
+  pool.deallocate(p, 300);
+  ASSERT_EQ(pool.allocate(512), p);
+  // Not pooled: too large, or aligned to more than a cache line.
+  void* big = pool.allocate(1 << 17);
+  pool.deallocate(big, 1 << 17);
+  void* aligned = pool.allocate(64, 4096);
+  ASSERT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 4096, 0u);
+  pool.deallocate(aligned, 64, 4096);
+  // Every pooled block is free again after reset.
+  pool.reset();
+  std::set<void*> again;
+  for (size_t bytes : {1, 64, 65, 100, 128, 1000, 4096, 5000, 65536})
+    for (int k = 0; k < 5; ++k)
+      again.insert(pool.allocate(bytes));
+  ASSERT_EQ(again.size(), live.size());
+}
+
+TEST(TestResourceAllocator, rebind) {
+  KokkosEx::arena_resource arena, other;
+  KokkosEx::arena_allocator<double> a(&arena);
+  KokkosEx::arena_allocator<int> b(a);
+  KokkosEx::arena_allocator<int> c(&other);
+  static_assert(std::is_same<std::allocator_traits<KokkosEx::arena_allocator<double>>::rebind_alloc<int>,
+                             KokkosEx::arena_allocator<int>>::value, "");
+  static_assert(!std::is_default_constructible<KokkosEx::arena_allocator<double>>::value, "");
+  ASSERT_TRUE(a == b);
+  ASSERT_TRUE(b != c);
+  std::vector<int, KokkosEx::arena_allocator<int>> v(10, 3, b);
+  ASSERT_EQ(v[9], 3);
+}
@@ -0,0 +1,82 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+template <class T, class Extents, class Layout = Kokkos::layout_right>
+using restrict_mdspan = Kokkos::mdspan<T, Extents, Layout, KokkosEx::restrict_accessor<T>>;
+
+TEST(TestRestrictAccessor, access) {
+  float data[12];
+  std::iota(data, data + 12, 0.f);
+  restrict_mdspan<float, Kokkos::extents<int, 3, 4>> m(data);
+  ASSERT_EQ((__MDSPAN_OP(m, 2, 1)), 9.f);
+  __MDSPAN_OP(m, 0, 3) = -1.f;
+  ASSERT_EQ(data[3], -1.f);
+}
+
+TEST(TestRestrictAccessor, conversions) {
+  using acc_t = KokkosEx::restrict_accessor<float>;
+  static_assert(std::is_convertible_v<acc_t, KokkosEx::restrict_accessor<const float>>);
+  static_assert(!std::is_constructible_v<acc_t, KokkosEx::restrict_accessor<const float>>);
+  static_assert(std::is_convertible_v<acc_t, Kokkos::default_accessor<float>>);
+  static_assert(std::is_constructible_v<acc_t, Kokkos::default_accessor<float>>);
+  static_assert(!std::is_convertible_v<Kokkos::default_accessor<float>, acc_t>);
+
+  float data[8] = {};
+  restrict_mdspan<float, Kokkos::dextents<int, 1>> a(data, 8);
+  Kokkos::mdspan<const float, Kokkos::dextents<int, 1>> b = a;
+  ASSERT_EQ(b.data_handle(), data);
+
+  // Slices of the same mdspan may overlap, so they drop the restrict promise.
+  auto sub = KokkosEx::submdspan(a, std::pair<int, int>{2, 6});
+  static_assert(std::is_same_v<decltype(sub)::accessor_type, Kokkos::default_accessor<float>>);
+  ASSERT_EQ(sub.data_handle(), data + 2);
+}
+
+TEST(TestRestrictAccessor, algorithms) {
+  using ext_t = Kokkos::dextents<int, 2>;
+  std::vector<double> a(30), b(30), c(30);
+  std::iota(a.begin(), a.end(), 1.);
+  restrict_mdspan<const double, ext_t> ra(a.data(), 5, 6);
+  restrict_mdspan<double, ext_t> rb(b.data(), 5, 6);
+  restrict_mdspan<double, ext_t, Kokkos::layout_left> rc(c.data(), 5, 6);
+
+  KokkosEx::copy(ra, rb);
+  ASSERT_EQ(a, b);
+
+  // layout_right to layout_left goes through the transposing kernel.
+  KokkosEx::copy(ra, rc);
+  for(int i = 0; i < 5; ++i)
+    for(int j = 0; j < 6; ++j)
+      ASSERT_EQ((__MDSPAN_OP(rc, i, j)), (__MDSPAN_OP(ra, i, j)));
+
+  std::vector<double> d(30);
+  restrict_mdspan<double, ext_t> rd(d.data(), 5, 6);
+  KokkosEx::transform(ra, rb, rd, [](double x, double y) { return x + y; });
+  for(size_t i = 0; i < a.size(); ++i)
+    ASSERT_EQ(d[i], 2. * a[i]);
+
+  ASSERT_EQ(KokkosEx::reduce(ra, 0., std::plus<>{}), 465.);
+}
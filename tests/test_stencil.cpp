@@ -0,0 +1,206 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/mdspan.hpp>
+#include <mdspan/algorithm.hpp>
+#include <array>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+template<class MDSpan>
+void fill_pattern(MDSpan s, int seed) {
+  for(int i = 0; i < s.extent(0); ++i)
+    for(int j = 0; j < s.extent(1); ++j)
+      for(int k = 0; k < s.extent(2); ++k)
+        __MDSPAN_OP(s, i, j, k) = (i * 7 + j * 13 + k * 29 + seed) % 17;
+}
+
+// Plain box sum over the interior, leaving the boundary alone.
+template<class Src, class Dst>
+void reference_box_sum(Src src, Dst dst, int r) {
+  for(int i = r; i < src.extent(0) - r; ++i)
+    for(int j = r; j < src.extent(1) - r; ++j)
+      for(int k = r; k < src.extent(2) - r; ++k) {
+        int sum = 0;
+        for(int di = -r; di <= r; ++di)
+          for(int dj = -r; dj <= r; ++dj)
+            for(int dk = -r; dk <= r; ++dk)
+              sum += __MDSPAN_OP(src, i + di, j + dj, k + dk);
+        __MDSPAN_OP(dst, i, j, k) = sum;
+      }
+}
+
+template<class A, class B>
+void expect_equal(A a, B b) {
+  for(int i = 0; i < a.extent(0); ++i)
+    for(int j = 0; j < a.extent(1); ++j)
+      for(int k = 0; k < a.extent(2); ++k)
+        ASSERT_EQ((__MDSPAN_OP(a, i, j, k)), (__MDSPAN_OP(b, i, j, k)))
+            << "at " << i << ", " << j << ", " << k;
+}
+
+template<class Layout>
+struct TestStencil : public ::testing::Test {
+  using mdspan_type = Kokkos::mdspan<int, Kokkos::dextents<int, 3>, Layout>;
+
+  static mdspan_type make(std::vector<int>& v, int n_slow, int n_mid, int n_fast) {
+    v.assign(size_t(n_slow) * n_mid * n_fast, 0);
+    if constexpr (std::is_same<Layout, Kokkos::layout_left>::value)
+      return mdspan_type(v.data(), n_fast, n_mid, n_slow);
+    else
+      return mdspan_type(v.data(), n_slow, n_mid, n_fast);
+  }
+};
+
+using layouts = ::testing::Types<Kokkos::layout_left, Kokkos::layout_right>;
+TYPED_TEST_SUITE(TestStencil, layouts);
+
+TYPED_TEST(TestStencil, box_sum) {
+  // For radius 4 the planes no longer fit in cache and the middle dimension
+  // is split into tiles.
+  for(int r : {0, 1, 2, 4}) {
+    std::vector<int> vs, vo, vref;
+    auto s = TestFixture::make(vs, 9, 37, 1000);
+    auto o = TestFixture::make(vo, 9, 37, 1000);
+    auto ref = TestFixture::make(vref, 9, 37, 1000);
+    fill_pattern(s, 1);
+    fill_pattern(o, 2);
+    fill_pattern(ref, 2);
+    KokkosEx::stencil(s, o, r);
+    reference_box_sum(s, ref, r);
+    expect_equal(o, ref);
+
+    fill_pattern(o, 2);
+    KokkosEx::stencil(KokkosEx::execution::openmp, s, o, r);
+    expect_equal(o, ref);
+  }
+}
+
+TYPED_TEST(TestStencil, functor) {
+  std::vector<int> vs, vo;
+  auto s = TestFixture::make(vs, 6, 20, 30);
+  auto o = TestFixture::make(vo, 6, 20, 30);
+  fill_pattern(s, 3);
+  // Seven point Laplacian.
+  KokkosEx::stencil(s, o, 1, [](const auto& n) {
+    return n(1, 0, 0) + n(-1, 0, 0) + n(0, 1, 0) + n(0, -1, 0) +
+           n(0, 0, 1) + n(0, 0, -1) - 6 * n(0, 0, 0);
+  });
+  for(int i = 0; i < s.extent(0); ++i)
+    for(int j = 0; j < s.extent(1); ++j)
+      for(int k = 0; k < s.extent(2); ++k) {
+        const bool interior = i > 0 && j > 0 && k > 0 && i + 1 < s.extent(0) &&
+                              j + 1 < s.extent(1) && k + 1 < s.extent(2);
+        const int expected =
+            interior ? __MDSPAN_OP(s, i + 1, j, k) + __MDSPAN_OP(s, i - 1, j, k) +
+                       __MDSPAN_OP(s, i, j + 1, k) + __MDSPAN_OP(s, i, j - 1, k) +
+                       __MDSPAN_OP(s, i, j, k + 1) + __MDSPAN_OP(s, i, j, k - 1) -
+                       6 * __MDSPAN_OP(s, i, j, k)
+                     : 0;
+        ASSERT_EQ((__MDSPAN_OP(o, i, j, k)), expected);
+      }
+}
+
+TYPED_TEST(TestStencil, iterate) {
+  // Plain sweeps on the first grid; on the second the planes don't fit in
+  // cache, so steps are fused into wavefronts over many tiles.
+  struct grid { int n_slow, n_mid, n_fast; std::vector<size_t> steps; };
+  for(const grid& g : {grid{23, 19, 600, {1, 2, 3, 6, 9}}, grid{7, 37, 2000, {9}}})
+  for(int r : {1, 2}) {
+    for(size_t steps : g.steps) {
+      std::vector<int> va, vb, vra, vrb;
+      auto a = TestFixture::make(va, g.n_slow, g.n_mid, g.n_fast);
+      auto b = TestFixture::make(vb, g.n_slow, g.n_mid, g.n_fast);
+      auto ra = TestFixture::make(vra, g.n_slow, g.n_mid, g.n_fast);
+      auto rb = TestFixture::make(vrb, g.n_slow, g.n_mid, g.n_fast);
+      // Small values so that repeated box sums don't overflow.
+      for(auto s : {a, b, ra, rb})
+        for(int i = 0; i < s.extent(0); ++i)
+          for(int j = 0; j < s.extent(1); ++j)
+            for(int k = 0; k < s.extent(2); ++k)
+              __MDSPAN_OP(s, i, j, k) = (i + 2 * j + 3 * k) % 3 - 1;
+      // Scale the box sums down again to keep the values bounded.
+      auto f = [r](const auto& n) {
+        int sum = 0;
+        for(int di = -r; di <= r; ++di)
+          for(int dj = -r; dj <= r; ++dj)
+            for(int dk = -r; dk <= r; ++dk)
+              sum += n(di, dj, dk);
+        return sum % 5;
+      };
+      auto result = KokkosEx::stencil_iterate(a, b, r, steps, f);
+      ASSERT_EQ(result.data_handle(), steps % 2 ? b.data_handle() : a.data_handle());
+      for(size_t t = 0; t < steps; ++t) {
+        if(t % 2 == 0)
+          KokkosEx::stencil(ra, rb, r, f);
+        else
+          KokkosEx::stencil(rb, ra, r, f);
+      }
+      expect_equal(result, steps % 2 ? rb : ra);
+    }
+  }
+}
+
+TEST(TestStencilGeneric, layout_stride) {
+  // Falls back to the mapping; compare against the blocked layout_right path.
+  using exts_t = Kokkos::extents<int, 8, dyn, 9>;
+  Kokkos::layout_stride::mapping<exts_t> map(exts_t(10), std::array<int, 3>{1, 8 * 9, 8});
+  std::vector<int> vs(map.required_span_size()), vo(map.required_span_size());
+  Kokkos::mdspan<int, exts_t, Kokkos::layout_stride> s(vs.data(), map), o(vo.data(), map);
+  fill_pattern(s, 5);
+
+  std::vector<int> vrs(8 * 10 * 9), vro(8 * 10 * 9);
+  Kokkos::mdspan<int, exts_t> rs(vrs.data(), 10), ro(vro.data(), 10);
+  fill_pattern(rs, 5);
+
+  KokkosEx::stencil(s, o, 1);
+  KokkosEx::stencil(rs, ro, 1);
+  expect_equal(o, ro);
+
+  auto result = KokkosEx::stencil_iterate(s, o, 1, 3);
+  auto ref = KokkosEx::stencil_iterate(rs, ro, 1, 3);
+  expect_equal(result, ref);
+}
+
+TEST(TestStencilGeneric, small_grid) {
+  // Grids without interior are left alone.
+  std::vector<int> vs(2 * 5 * 5, 1), vo(2 * 5 * 5, 7);
+  Kokkos::mdspan<int, Kokkos::dextents<int, 3>> s(vs.data(), 2, 5, 5), o(vo.data(), 2, 5, 5);
+  KokkosEx::stencil(s, o, 1);
+  KokkosEx::stencil_iterate(s, o, 1, 4);
+  for(int v : vo)
+    ASSERT_EQ(v, 7);
+}
+
+TEST(TestStencilGeneric, small_grid_unsigned) {
+  // Extents smaller than the radius must not wrap around the loop bounds.
+  using exts_t = Kokkos::dextents<size_t, 3>;
+  Kokkos::layout_stride::mapping<exts_t> map(exts_t(1, 5, 5), std::array<size_t, 3>{25, 5, 1});
+  std::vector<int> vs(map.required_span_size(), 1), vo(map.required_span_size(), 7);
+  Kokkos::mdspan<int, exts_t, Kokkos::layout_stride> s(vs.data(), map), o(vo.data(), map);
+  auto f = [](const auto& n) { return n(0, 0, 0); };
+  KokkosEx::stencil(s, o, 2, f);
+  KokkosEx::stencil_iterate(s, o, 2, 3, f);
+  for(int v : vs)
+    ASSERT_EQ(v, 1);
+  for(int v : vo)
+    ASSERT_EQ(v, 7);
+}
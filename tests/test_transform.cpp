@@ -0,0 +1,132 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <mdspan/algorithm.hpp>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+
+namespace KokkosEx = MDSPAN_IMPL_STANDARD_NAMESPACE::MDSPAN_IMPL_PROPOSED_NAMESPACE;
+
+_MDSPAN_INLINE_VARIABLE constexpr auto dyn = Kokkos::dynamic_extent;
+
+// Accessor the transform kernels can not bypass, exercising the generic path.
+template<class ElementType>
+struct counting_accessor {
+  using offset_policy = counting_accessor;
+  using element_type = ElementType;
+  using reference = ElementType&;
+  using data_handle_type = ElementType*;
+
+  MDSPAN_INLINE_FUNCTION constexpr counting_accessor() noexcept = default;
+
+  reference access(data_handle_type p, size_t i) const noexcept {
+    ++(*count);
+    return p[i];
+  }
+  data_handle_type offset(data_handle_type p, size_t i) const noexcept {
+    return p + i;
+  }
+
+  int* count = nullptr;
+};
+
+template<class MDSpan>
+void iota_fill(MDSpan s, int v = 0) {
+  for(int i = 0; i < s.extent(0); ++i)
+    for(int j = 0; j < s.extent(1); ++j)
+      for(int k = 0; k < s.extent(2); ++k)
+        __MDSPAN_OP(s, i, j, k) = v++;
+}
+
+template<class LayoutA, class LayoutB, class LayoutDst>
+void test_transform_layouts(int n0, int n1, int n2) {
+  using ext_t = Kokkos::dextents<int, 3>;
+  ext_t exts(n0, n1, n2);
+  const size_t size = size_t(n0) * n1 * n2;
+  std::vector<int> a(size), b(size);
+  std::vector<long> c(size, -1), d(size, -1);
+  Kokkos::mdspan<int, ext_t, LayoutA> ma(a.data(), exts);
+  Kokkos::mdspan<int, ext_t, LayoutB> mb(b.data(), exts);
+  Kokkos::mdspan<long, ext_t, LayoutDst> mc(c.data(), exts);
+  Kokkos::mdspan<long, ext_t, LayoutDst> md(d.data(), exts);
+  iota_fill(ma);
+  iota_fill(mb, 1000);
+
+  KokkosEx::transform(ma, mc, [](int x) { return 2l * x; });
+  KokkosEx::transform(ma, mb, md, [](int x, int y) { return long(y) - x; });
+  for(int i = 0; i < n0; ++i)
+    for(int j = 0; j < n1; ++j)
+      for(int k = 0; k < n2; ++k) {
+        ASSERT_EQ((__MDSPAN_OP(mc, i, j, k)), 2l * (__MDSPAN_OP(ma, i, j, k)));
+        ASSERT_EQ((__MDSPAN_OP(md, i, j, k)), 1000l);
+      }
+}
+
+TEST(TestTransform, same_layout) {
+  test_transform_layouts<Kokkos::layout_right, Kokkos::layout_right, Kokkos::layout_right>(3, 4, 5);
+  test_transform_layouts<Kokkos::layout_left, Kokkos::layout_left, Kokkos::layout_left>(3, 4, 5);
+}
+
+TEST(TestTransform, mixed_layouts) {
+  test_transform_layouts<Kokkos::layout_left, Kokkos::layout_right, Kokkos::layout_right>(3, 4, 5);
+  test_transform_layouts<Kokkos::layout_right, Kokkos::layout_left, Kokkos::layout_left>(6, 1, 7);
+}
+
+TEST(TestTransform, layout_stride) {
+  std::vector<int> a(8 * 10 * 12);
+  std::vector<int> b(4 * 10 * 6, 0);
+  Kokkos::mdspan<int, Kokkos::extents<int, 8, 10, 12>> src(a.data());
+  iota_fill(src);
+
+  // Every other plane and column of src, negated into a compact destination.
+  auto sub = KokkosEx::submdspan(src, KokkosEx::strided_slice<int, int, int>{0, 8, 2},
+                                 Kokkos::full_extent, KokkosEx::strided_slice<int, int, int>{1, 12, 2});
+  Kokkos::mdspan<int, Kokkos::extents<int, 4, 10, dyn>> dst(b.data(), 6);
+  KokkosEx::transform(sub, dst, [](int x) { return -x; });
+  for(int i = 0; i < 4; ++i)
+    for(int j = 0; j < 10; ++j)
+      for(int k = 0; k < 6; ++k)
+        ASSERT_EQ((__MDSPAN_OP(dst, i, j, k)), -(__MDSPAN_OP(src, 2 * i, j, 2 * k + 1)));
+}
+
+TEST(TestTransform, rank_0) {
+  int a = 3, b = 0;
+  Kokkos::mdspan<int, Kokkos::extents<int>> src(&a);
+  Kokkos::mdspan<int, Kokkos::extents<int>> dst(&b);
+  KokkosEx::transform(src, dst, [](int x) { return x + 1; });
+  ASSERT_EQ(b, 4);
+}
+
+TEST(TestTransform, generic_accessor) {
+  std::vector<int> a(24);
+  std::vector<int> b(24);
+  int count = 0;
+  counting_accessor<int> acc;
+  acc.count = &count;
+  using ext_t = Kokkos::extents<int, 2, 3, 4>;
+  Kokkos::mdspan<int, ext_t> src(a.data());
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_left, counting_accessor<int>>
+    dst(b.data(), Kokkos::layout_left::mapping<ext_t>(), acc);
+  iota_fill(src);
+  KokkosEx::transform(src, dst, [](int x) { return x * x; });
+  ASSERT_EQ(count, 24);
+  Kokkos::mdspan<int, ext_t, Kokkos::layout_left> check(b.data());
+  for(int i = 0; i < 2; ++i)
+    for(int j = 0; j < 3; ++j)
+      for(int k = 0; k < 4; ++k)
+        ASSERT_EQ((__MDSPAN_OP(check, i, j, k)), (__MDSPAN_OP(src, i, j, k)) * (__MDSPAN_OP(src, i, j, k)));
+}